@@ -0,0 +1,92 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CONFIGSTORE_HPP
+#define CARD_COUNTER_CONFIGSTORE_HPP
+
+// Qt
+#include <QFutureWatcher>
+#include <QJsonObject>
+#include <QObject>
+#include <QThreadPool>
+
+class QTimer;
+
+/**
+ * @brief Persistent state of the game, written in the background.
+ *
+ * The whole state is one JSON document of groups, read in one pass when
+ * the store is created. Changes only touch the copy in memory and restart
+ * a short timer; when it fires, a snapshot is written on a worker thread
+ * and atomically replaces the file, so the GUI never waits for the disk
+ * and a crash leaves either the old or the new file. Changes made while a
+ * write is running are coalesced into the next one.
+ */
+class ConfigStore final : public QObject {
+    Q_OBJECT
+public:
+    /** Store in the application config directory. */
+    static ConfigStore& instance();
+
+    /** Store backed by @p path; reads it if it exists. */
+    explicit ConfigStore(QString path, QObject* parent = nullptr);
+
+    /** Writes pending changes before returning. */
+    ~ConfigStore() override;
+
+    [[nodiscard]] const QString& get_path() const noexcept { return path; }
+
+    [[nodiscard]] bool contains(const QString& group) const;
+
+    [[nodiscard]] QJsonObject group(const QString& name) const;
+
+    [[nodiscard]] QJsonValue
+    value(const QString& group, const QString& key) const;
+
+    /** Change one value and schedule a write. */
+    void set_value(
+        const QString& group, const QString& key, const QJsonValue& value
+    );
+
+    /** Write pending changes now and wait for them. */
+    void flush();
+
+private:
+    void schedule();
+
+    /** Start writing a snapshot unless a write is already running. */
+    void write_snapshot();
+
+    static bool write_file(const QString& path, const QJsonObject& root);
+
+    QString path;
+    QJsonObject root;
+    QTimer* timer;
+    /** Runs one write at a time, in order. */
+    QThreadPool writer;
+    QFutureWatcher<bool> written;
+    bool dirty = false;
+};
+
+#endif // CARD_COUNTER_CONFIGSTORE_HPP
@@ -0,0 +1,97 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_BATCH_HPP
+#define CARD_COUNTER_CORE_BATCH_HPP
+
+// std
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+// own
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** Implementations of the batch counting loops. */
+enum class CountKernel { Scalar, Avx2, Neon };
+
+/** Fastest kernel the running processor supports. */
+[[nodiscard]] CountKernel best_count_kernel() noexcept;
+
+[[nodiscard]] const char* kernel_name(CountKernel kernel) noexcept;
+
+/**
+ * @brief Running counts of many strategies over a stream of card ids.
+ *
+ * Each strategy becomes a 16 entry table of deltas indexed by the low four
+ * bits of the card id, which hold the rank; jokers count zero. The table
+ * fits a single vector register, so the SIMD kernels look deltas up with
+ * a byte shuffle (vpshufb with AVX2, tbl with NEON) instead of a gather,
+ * and build traces with in-register prefix sums.
+ */
+class CountBatch {
+public:
+    explicit CountBatch(
+        std::span<const Weights> strategies,
+        CountKernel kernel = best_count_kernel()
+    );
+
+    /** Number of strategies. */
+    [[nodiscard]] std::size_t size() const noexcept { return tables.size(); }
+
+    [[nodiscard]] CountKernel get_kernel() const noexcept { return kernel; }
+
+    /**
+     * @brief Add the count of @p cards to the running count of every
+     *        strategy.
+     * @param counts one running count per strategy
+     */
+    void count(
+        std::span<const std::int32_t> cards, std::span<std::int32_t> counts
+    ) const;
+
+    /**
+     * @brief Running count after every card, for every strategy.
+     *
+     * Strategy s writes cards.size() counts starting at
+     * traces[s * cards.size()], continuing from counts[s]; counts holds
+     * the final counts afterwards, so long streams can be traced in parts.
+     */
+    void trace(
+        std::span<const std::int32_t> cards, std::span<std::int32_t> counts,
+        std::span<std::int32_t> traces
+    ) const;
+
+private:
+    using Table = std::array<std::int8_t, 16>;
+
+    std::vector<Table> tables;
+    CountKernel kernel;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_BATCH_HPP
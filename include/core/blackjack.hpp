@@ -0,0 +1,171 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_BLACKJACK_HPP
+#define CARD_COUNTER_CORE_BLACKJACK_HPP
+
+// std
+#include <array>
+#include <cstdint>
+
+namespace core {
+
+/**
+ * @name Hand states
+ * A hand's total fits in one byte: hard totals are 0..21, a soft total,
+ * one counting an ace as 11, adds hand_soft, and every busted hand is
+ * hand_bust. Adding a card is a single lookup in a precomputed table.
+ */
+///@{
+inline constexpr std::uint8_t hand_soft = 32;
+inline constexpr std::uint8_t hand_bust = 22;
+inline constexpr std::int32_t hand_states = 64;
+
+[[nodiscard]] constexpr std::int32_t
+hand_total(const std::uint8_t state) noexcept {
+    return state & (hand_soft - 1);
+}
+
+[[nodiscard]] constexpr bool is_soft(const std::uint8_t state) noexcept {
+    return state & hand_soft;
+}
+
+/** Blackjack value of a rank, 1 for an ace and 10 for the pictures. */
+[[nodiscard]] std::int32_t card_value(std::int32_t rank) noexcept;
+
+/** State after drawing a card of @p rank. */
+[[nodiscard]] std::uint8_t
+add_card(std::uint8_t state, std::int32_t rank) noexcept;
+///@}
+
+enum class Action : std::uint8_t { Hit, Stand, Double, Split };
+
+/** One player hand, or the dealer's. */
+struct Hand {
+    std::uint8_t state = 0;
+    std::uint8_t cards = 0;
+    /** Value of the first card, to spot pairs. */
+    std::uint8_t first = 0;
+    /** Seat the hand was split from. */
+    std::uint8_t seat = 0;
+    bool pair = false;
+    bool doubled = false;
+    bool split = false;
+    bool done = false;
+
+    /** Two card 21 that was not split. */
+    [[nodiscard]] bool is_natural() const noexcept {
+        return cards == 2 && !split && hand_total(state) == 21;
+    }
+};
+
+/**
+ * @brief Basic strategy move, looked up rather than computed.
+ *
+ * For six to eight decks where the dealer stands on soft 17 and doubling
+ * is allowed on any two cards, after splits too, without surrender.
+ * @param up value of the dealer's up card, see card_value()
+ * @param can_split whether the seat may still split
+ */
+[[nodiscard]] Action
+basic_strategy(const Hand& hand, std::int32_t up, bool can_split) noexcept;
+
+/**
+ * @brief Round of blackjack fed one card at a time.
+ *
+ * The cards come in the order a dealer gives them: one to every seat,
+ * the dealer's up card, a second to every seat, the hole card, then the
+ * cards the players ask for by basic_strategy() and finally the dealer's.
+ * The round works out who gets the next card itself, so it can take the
+ * cards a slot deals anyway and counting goes on as before.
+ *
+ * Splits make up to four hands per seat and split aces take one card
+ * each; blackjack pays 3:2 and the dealer peeks for one. Results are in
+ * half bets to stay integral.
+ */
+class BlackjackRound {
+public:
+    static constexpr std::int32_t max_seats = 7;
+    static constexpr std::int32_t max_hands_per_seat = 4;
+
+    /** Players at the table, 0 plays no rounds; starts a new round. */
+    void set_seats(std::int32_t value) noexcept;
+
+    [[nodiscard]] std::int32_t get_seats() const noexcept { return seats; }
+
+    /** Drop the round in progress, as when the shoe is refilled. */
+    void reset() noexcept;
+
+    /**
+     * @brief Hand out the next card of the shoe.
+     *
+     * A card after a finished round starts the next one.
+     * @return whether the card finished the round
+     */
+    bool add(std::int32_t rank) noexcept;
+
+    /** Whether the round is settled, see get_net(). */
+    [[nodiscard]] bool is_over() const noexcept {
+        return current_phase == phase::Over;
+    }
+
+    /** Winnings of all hands in half bets, once the round is over. */
+    [[nodiscard]] std::int32_t get_net() const noexcept { return net; }
+
+    [[nodiscard]] const Hand& get_dealer() const noexcept { return dealer; }
+
+    /** Player hands, splits included, in the order they are played. */
+    [[nodiscard]] std::int32_t get_hand_count() const noexcept {
+        return hand_count;
+    }
+
+    [[nodiscard]] const Hand& get_hand(std::int32_t index) const noexcept {
+        return hands[static_cast<std::size_t>(index)];
+    }
+
+private:
+    enum class phase : std::uint8_t { Deal, Play, Dealer, Over };
+
+    /** Make the moves that need no card, up to the next one that does. */
+    void play_on() noexcept;
+
+    /** Let the dealer draw or settle once every hand is done. */
+    void dealer_turn() noexcept;
+
+    void settle() noexcept;
+
+    std::array<Hand, max_seats * max_hands_per_seat> hands {};
+    std::array<std::uint8_t, max_seats> seat_hands {};
+    Hand dealer;
+    std::int32_t seats = 0;
+    std::int32_t hand_count = 0;
+    /** Hand to play, or the card of the first deal to hand out. */
+    std::int32_t current = 0;
+    std::int32_t net = 0;
+    phase current_phase = phase::Deal;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_BLACKJACK_HPP
@@ -0,0 +1,128 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_BUILTINS_HPP
+#define CARD_COUNTER_CORE_BUILTINS_HPP
+
+// std
+#include <algorithm>
+#include <array>
+#include <string_view>
+// own
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** A counting system that ships with the game. */
+struct BuiltinStrategy {
+    /** English name, also the key the translations and settings use. */
+    std::string_view name;
+    Weights weights;
+    /** Largest absolute weight. */
+    std::int32_t level;
+    /** Whether a full deck counts to zero. */
+    bool balanced;
+    /** Units per point, see Strategy. */
+    std::int32_t scale = 1;
+};
+
+inline constexpr std::size_t builtin_count = 8;
+
+/** Built-in systems in the order the game lists them. */
+inline constexpr std::array<BuiltinStrategy, builtin_count> builtin_table { {
+    { "Hi-Opt I Count",
+      { 0, 0, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1 },
+      1,
+      true },
+    { "Hi-Lo Count",
+      { -1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1 },
+      1,
+      true },
+    { "Hi-Opt II Count",
+      { 0, 1, 1, 2, 2, 1, 1, 0, 0, -2, -2, -2, -2 },
+      2,
+      true },
+    { "KO Count",
+      { -1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1 },
+      1,
+      false },
+    { "Omega II Count",
+      { 0, 1, 1, 2, 2, 2, 1, 0, -1, -2, -2, -2, -2 },
+      2,
+      true },
+    { "Zen Count",
+      { -1, 1, 1, 2, 2, 2, 1, 0, 0, -2, -2, -2, -2 },
+      2,
+      true },
+    { "10 Count", { 1, 1, 1, 1, 1, 1, 1, 1, 1, -2, -2, -2, -2 }, 2, false },
+    // -1, +0.5, +1, +1, +1.5, +1, +0.5, 0, -0.5, -1 in halves
+    { "Wong Halves Count",
+      { -2, 1, 2, 2, 3, 2, 1, 0, -1, -2, -2, -2, -2 },
+      3,
+      true,
+      2 },
+} };
+
+[[nodiscard]] constexpr const std::array<BuiltinStrategy, builtin_count>&
+builtin_strategies() noexcept {
+    return builtin_table;
+}
+
+/** Whether the level and balance flags agree with the weights. */
+[[nodiscard]] constexpr bool
+is_consistent(const BuiltinStrategy& builtin) noexcept {
+    const Strategy strategy(builtin.weights);
+    const auto tens = builtin.weights.begin() + (Ten - Ace);
+    return !builtin.name.empty() && builtin.scale >= 1
+        && builtin.scale <= max_scale && strategy.level() == builtin.level
+        && strategy.is_balanced() == builtin.balanced
+        && std::all_of(tens, builtin.weights.end(), [&tens](const auto weight) {
+               return weight == *tens;
+           });
+}
+
+[[nodiscard]] constexpr bool has_unique_names() noexcept {
+    for (std::size_t i = 0; i < builtin_count; ++i) {
+        for (std::size_t j = i + 1; j < builtin_count; ++j) {
+            if (builtin_table[i].name == builtin_table[j].name) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(
+    std::all_of(builtin_table.begin(), builtin_table.end(), is_consistent),
+    "a built-in strategy has a wrong level, balance flag or ten weights"
+);
+static_assert(has_unique_names(), "built-in strategy names must be unique");
+static_assert(
+    Strategy(builtin_table[1].weights).update(0, Five) == 1,
+    "Hi-Lo counts a five as +1"
+);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_BUILTINS_HPP
@@ -0,0 +1,105 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_CARDS_HPP
+#define CARD_COUNTER_CORE_CARDS_HPP
+
+// std
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Widget-free game logic.
+ *
+ * Nothing in this namespace depends on Qt, so it can be unit tested,
+ * simulated and benchmarked without a display.
+ */
+namespace core {
+
+enum colour : std::int32_t { Black = 0, Red };
+
+enum suit : std::int32_t { Clubs = 0, Diamonds, Hearts, Spades };
+
+enum rank : std::int32_t {
+    Joker = 0,
+    Ace,
+    Two,
+    Three,
+    Four,
+    Five,
+    Six,
+    Seven,
+    Eight,
+    Nine,
+    Ten,
+    Jack,
+    Queen,
+    King
+};
+
+/** Number of distinct ranks a strategy assigns weights to. */
+inline constexpr std::int32_t rank_count = King;
+/** Cards in one deck, 52 standard cards and two jokers. */
+inline constexpr std::int32_t deck_size = 4 * rank_count + 2;
+/** Jokers in one deck. */
+inline constexpr std::int32_t jokers_per_deck = 2;
+
+/** Number of cards of each rank Ace..King, dealt or left in a shoe. */
+using RankCounts = std::array<std::int32_t, rank_count>;
+
+/**
+ * @brief Encode a card id.
+ *
+ * The suit (or colour for jokers) goes to the second byte, the rank to the
+ * first one; rank 0 denotes a joker.
+ */
+[[nodiscard]] constexpr std::int32_t
+make_card(const std::int32_t suit, const std::int32_t rank) noexcept {
+    return ((suit & 0xff) << 8) | (rank & 0xff);
+}
+
+[[nodiscard]] constexpr std::int32_t rank_of(const std::int32_t card) noexcept {
+    return card & 0xff;
+}
+
+[[nodiscard]] constexpr std::int32_t suit_of(const std::int32_t card) noexcept {
+    return (card >> 8) & 0xff;
+}
+
+[[nodiscard]] constexpr bool is_joker(const std::int32_t card) noexcept {
+    return rank_of(card) == Joker;
+}
+
+/**
+ * @brief Ordered cards of @p deck_count decks.
+ *
+ * Each deck lists its 52 standard cards rank by rank followed by the two
+ * jokers.
+ */
+[[nodiscard]] std::vector<std::int32_t> generate_deck(std::int32_t deck_count);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_CARDS_HPP
@@ -0,0 +1,96 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_CONTINUOUSSHOE_HPP
+#define CARD_COUNTER_CORE_CONTINUOUSSHOE_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+// own
+#include "core/fenwicktree.hpp"
+
+namespace core {
+
+class Random;
+
+/**
+ * @brief Shoe of a continuous shuffling machine.
+ *
+ * Dealt cards wait in a discard tray and go back into the machine at a
+ * random position once @p delay more cards were dealt, so the shoe never
+ * runs out and its composition hardly drifts from full decks, which is
+ * what makes counting useless against a real machine.
+ *
+ * The cards in the machine are in random order, and inserting a discard
+ * at a random position keeps them so; taking the next card is then the
+ * same as taking the k-th of them in any fixed order for a uniformly
+ * random k. The machine is therefore kept as the number of copies of
+ * every card in a FenwickTree, where finding the k-th card, taking it and
+ * putting a discard back are O(log n) in the distinct cards, and nothing
+ * is ever moved.
+ */
+class ContinuousShoe {
+public:
+    /**
+     * @brief Load @p deck_count decks into the machine, the tray empty.
+     * @param delay cards dealt before a discard goes back, at most all but
+     *              one card of the shoe
+     */
+    void fill(std::int32_t deck_count, std::int32_t delay);
+
+    void clear() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept { return machine_cards == 0; }
+
+    /** Take a card and put the oldest discard back if it is due. */
+    std::int32_t draw(Random& rng);
+
+    /** Cards in the machine and the tray together. */
+    [[nodiscard]] std::int32_t size() const noexcept {
+        return machine_cards + tray_count;
+    }
+
+    /** Cards the next draw is taken from. */
+    [[nodiscard]] std::int32_t in_machine() const noexcept {
+        return machine_cards;
+    }
+
+    /** Discards waiting to go back. */
+    [[nodiscard]] std::int32_t in_tray() const noexcept { return tray_count; }
+
+private:
+    /** Copies of every card by slot_of(), as weights. */
+    FenwickTree machine;
+    /** Ring buffer of the discards, the oldest at tray_head. */
+    std::vector<std::int32_t> tray;
+    std::size_t tray_head = 0;
+    std::int32_t tray_count = 0;
+    std::int32_t machine_cards = 0;
+    std::int32_t delay = 0;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_CONTINUOUSSHOE_HPP
@@ -0,0 +1,200 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_COUNTERSET_HPP
+#define CARD_COUNTER_CORE_COUNTERSET_HPP
+
+// std
+#include <array>
+#include <cstdint>
+// own
+#include "core/strategy.hpp"
+
+namespace core {
+
+/**
+ * @brief The counts one slot keeps at once: a main count and side counts.
+ *
+ * Every counter has its own Strategy, such as an ace side count next to
+ * Hi-Opt II. The running counts are packed into the 32 bit lanes of two
+ * words, and so are the weights of every rank, so a card updates all
+ * counters with one lane-wise addition per word however many there are.
+ *
+ * A lane holds any count an int32 does, so an unbalanced count that drifts
+ * without end in infinity mode stays exact for as long as anyone plays.
+ */
+class CounterSet {
+public:
+    /** Counters that fit in the packed words, the main count included. */
+    static constexpr std::int32_t max_counters = 4;
+
+    /** Running counts of all counters, two lanes per word. */
+    using Counts = std::array<std::uint64_t, 2>;
+
+    CounterSet() = default;
+
+    constexpr explicit CounterSet(const Strategy& main) noexcept {
+        set(0, main);
+    }
+
+    /** Number of counters, at least the main one. */
+    [[nodiscard]] constexpr std::int32_t size() const noexcept {
+        return count;
+    }
+
+    /** Strategy of the counter at @p index, 0 being the main count. */
+    [[nodiscard]] constexpr const Strategy& get(const std::int32_t index
+    ) const {
+        return strategies[static_cast<std::size_t>(index)];
+    }
+
+    /**
+     * @brief Set the counter at @p index.
+     *
+     * An index equal to size() appends a counter; indices beyond that or
+     * past max_counters are ignored.
+     */
+    constexpr void set(const std::int32_t index, const Strategy& strategy) {
+        if (index < 0 || index > count || index >= max_counters) {
+            return;
+        }
+        strategies[static_cast<std::size_t>(index)] = strategy;
+        for (std::int32_t rank = Ace; rank <= King; ++rank) {
+            Counts& delta = deltas[static_cast<std::size_t>(rank - Ace)];
+            delta = assign(delta, index, strategy.get_weight(rank));
+        }
+        count = index == count ? count + 1 : count;
+    }
+
+    /** Drop the counters from @p size on, the main count always stays. */
+    constexpr void truncate(const std::int32_t size) {
+        for (std::int32_t index = size < 1 ? 1 : size; index < count;
+             ++index) {
+            strategies[static_cast<std::size_t>(index)] = Strategy();
+            for (Counts& delta : deltas) {
+                delta = reset(delta, index);
+            }
+        }
+        count = size < 1 ? 1 : size < count ? size : count;
+    }
+
+    /** Packed running counts after a card of the given rank. */
+    [[nodiscard]] constexpr Counts
+    update(const Counts& counts, const std::int32_t rank) const {
+        const Counts& delta = deltas[static_cast<std::size_t>(rank - Ace)];
+        return { add_lanes(counts[0], delta[0]),
+                 add_lanes(counts[1], delta[1]) };
+    }
+
+    /** Running count of the counter at @p index in packed @p counts. */
+    [[nodiscard]] static constexpr std::int32_t
+    extract(const Counts& counts, const std::int32_t index) noexcept {
+        return static_cast<std::int32_t>(static_cast<std::uint32_t>(
+            counts[word(index)] >> shift(index)
+        ));
+    }
+
+    /** @p counts with the lane of the counter at @p index set to zero. */
+    [[nodiscard]] static constexpr Counts
+    reset(Counts counts, const std::int32_t index) noexcept {
+        counts[word(index)] &= ~(std::uint64_t { 0xffff'ffff } << shift(index));
+        return counts;
+    }
+
+    /** @p counts with the counter at @p index set to @p value. */
+    [[nodiscard]] static constexpr Counts assign(
+        const Counts& counts, const std::int32_t index,
+        const std::int32_t value
+    ) noexcept {
+        Counts result = reset(counts, index);
+        result[word(index)]
+            |= std::uint64_t { static_cast<std::uint32_t>(value) }
+            << shift(index);
+        return result;
+    }
+
+private:
+    static constexpr std::int32_t lane_bits = 32;
+    /** Top bit of both lanes of a word. */
+    static constexpr std::uint64_t high_bits = 0x8000'0000'8000'0000ULL;
+
+    [[nodiscard]] static constexpr std::size_t
+    word(const std::int32_t index) noexcept {
+        return static_cast<std::size_t>(index / 2);
+    }
+
+    [[nodiscard]] static constexpr std::int32_t
+    shift(const std::int32_t index) noexcept {
+        return lane_bits * (index % 2);
+    }
+
+    /**
+     * @brief Add both lanes modulo 2^32 without a carry between them.
+     *
+     * The low 31 bits of each lane are added with the top bits cleared,
+     * so no carry leaves the lane; the top bits are then the sum of both
+     * top bits and the carry into them, which is an exclusive or.
+     */
+    [[nodiscard]] static constexpr std::uint64_t
+    add_lanes(const std::uint64_t a, const std::uint64_t b) noexcept {
+        return ((a & ~high_bits) + (b & ~high_bits)) ^ ((a ^ b) & high_bits);
+    }
+
+    /** Weights of all counters by rank, one lane per counter. */
+    std::array<Counts, rank_count> deltas {};
+    std::array<Strategy, max_counters> strategies {};
+    std::int32_t count = 1;
+};
+
+// a negative weight must not borrow from the next lane
+static_assert(
+    [] {
+        CounterSet set(Strategy({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1 }));
+        set.set(1, Strategy({ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }));
+        CounterSet::Counts counts = set.update(set.update({}, King), Ace);
+        counts = set.update(set.update(counts, King), King);
+        return CounterSet::extract(counts, 0) == -3
+            && CounterSet::extract(counts, 1) == 1
+            && CounterSet::extract(counts, 2) == 0;
+    }(),
+    "lanes must not carry into each other"
+);
+
+// counts far beyond those of a shoe stay exact
+static_assert(
+    [] {
+        CounterSet set(Strategy({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }));
+        set.set(1, Strategy({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1 }));
+        CounterSet::Counts counts = CounterSet::assign({}, 0, 40000);
+        counts = CounterSet::assign(counts, 1, -40000);
+        counts = set.update(counts, King);
+        return CounterSet::extract(counts, 0) == 40001
+            && CounterSet::extract(counts, 1) == -40001;
+    }(),
+    "lanes must hold 32 bit counts"
+);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_COUNTERSET_HPP
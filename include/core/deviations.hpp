@@ -0,0 +1,192 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_DEVIATIONS_HPP
+#define CARD_COUNTER_CORE_DEVIATIONS_HPP
+
+// std
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+// own
+#include "core/builtins.hpp"
+#include "core/parallel.hpp"
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** Answers of a deviation drill. */
+enum class Play : std::uint8_t {
+    Hit,
+    Stand,
+    Double,
+    Split,
+    Surrender,
+    Insure,
+    NoInsurance
+};
+
+/**
+ * @brief Situation whose right play depends on the true count.
+ *
+ * The player holds two cards against the dealer's up card, both by value
+ * as card_value() gives them; the insurance offer has no player cards.
+ */
+struct Deviation {
+    std::uint8_t first;
+    std::uint8_t second;
+    std::uint8_t up;
+    /** Play below the index. */
+    Play below;
+    /** Play at or above the index. */
+    Play above;
+
+    [[nodiscard]] constexpr bool is_insurance() const noexcept {
+        return first == 0;
+    }
+};
+
+inline constexpr std::size_t deviation_count = 22;
+
+/**
+ * The Illustrious 18 followed by the Fab 4 surrenders, for six to eight
+ * decks where the dealer stands on soft 17. Hard totals are played as a
+ * ten and a small card, the usual case.
+ */
+inline constexpr std::array<Deviation, deviation_count> deviations { {
+    { 0, 0, 1, Play::NoInsurance, Play::Insure },
+    { 10, 6, 10, Play::Hit, Play::Stand },
+    { 10, 5, 10, Play::Hit, Play::Stand },
+    { 10, 10, 5, Play::Stand, Play::Split },
+    { 10, 10, 6, Play::Stand, Play::Split },
+    { 6, 4, 10, Play::Hit, Play::Double },
+    { 10, 2, 3, Play::Hit, Play::Stand },
+    { 10, 2, 2, Play::Hit, Play::Stand },
+    { 6, 5, 1, Play::Hit, Play::Double },
+    { 5, 4, 2, Play::Hit, Play::Double },
+    { 6, 4, 1, Play::Hit, Play::Double },
+    { 5, 4, 7, Play::Hit, Play::Double },
+    { 10, 6, 9, Play::Hit, Play::Stand },
+    { 10, 3, 2, Play::Hit, Play::Stand },
+    { 10, 2, 4, Play::Hit, Play::Stand },
+    { 10, 2, 5, Play::Hit, Play::Stand },
+    { 10, 2, 6, Play::Hit, Play::Stand },
+    { 10, 3, 3, Play::Hit, Play::Stand },
+    { 10, 4, 10, Play::Hit, Play::Surrender },
+    { 10, 5, 10, Play::Hit, Play::Surrender },
+    { 10, 5, 9, Play::Hit, Play::Surrender },
+    { 10, 5, 1, Play::Hit, Play::Surrender },
+} };
+
+/** True count from which each of the deviations takes its upper play. */
+using IndexTable = std::array<std::int8_t, deviation_count>;
+
+/** Indices beyond this never, or always, change the play. */
+inline constexpr std::int8_t index_limit = 20;
+
+[[nodiscard]] constexpr Play play_at(
+    const Deviation& deviation, const std::int8_t index,
+    const std::int32_t true_count
+) noexcept {
+    return true_count >= index ? deviation.above : deviation.below;
+}
+
+/** The published Hi-Lo indices. */
+inline constexpr IndexTable hi_lo_indices { 3,  0,  4,  5,  4,  4, 2, 3,
+                                            1,  1,  4,  3,  5, -1, 0, -2,
+                                            -1, -2, 3,  0,  2,  1 };
+
+/*
+ * Indices of the shipped level two systems, in their points per deck, as
+ * kcuckounter-sim --indices --seed 24301 prints them, which simulates with
+ * the default parameters. The same run reproduces the Hi-Lo table above to
+ * within one.
+ */
+inline constexpr IndexTable hi_opt_ii_indices { 5,  0,  5,  8,  7,  5, 2, 5,
+                                                1,  2,  6,  6,  7, -1, 0, -2,
+                                                -1, -3, 4,  -1, 4,  3 };
+inline constexpr IndexTable omega_ii_indices { 5,  1,  5,  8,  7,  6, 3, 6,
+                                               2,  2,  7,  6,  9, -1, 0, -3,
+                                               -2, -3, 4,  -1, 3,  2 };
+inline constexpr IndexTable zen_indices { 5,  1,  6,  8,  8,  5, 2, 5,
+                                          1,  2,  6,  6,  10, -1, 0, -3,
+                                          -2, -3, 4,  -1, 4,  2 };
+
+/** Index tables of the built-in systems, nullptr where none ships. */
+inline constexpr std::array<const IndexTable*, builtin_count>
+    builtin_index_tables { nullptr,
+                           &hi_lo_indices,
+                           &hi_opt_ii_indices,
+                           nullptr,
+                           &omega_ii_indices,
+                           &zen_indices,
+                           nullptr,
+                           nullptr };
+
+static_assert(
+    builtin_table[1].name == "Hi-Lo Count"
+        && builtin_table[2].name == "Hi-Opt II Count"
+        && builtin_table[4].name == "Omega II Count"
+        && builtin_table[5].name == "Zen Count",
+    "index tables are listed in the order of builtin_table"
+);
+
+/** Conditions the indices are simulated under. */
+struct IndexParameters {
+    std::int32_t deck_count = 6;
+    /**
+     * Share of the shoe dealt before the reshuffle; the last situation
+     * still leaves a few cards to play it out.
+     */
+    double penetration = 0.75;
+    /** Shoes to deal for every deviation. */
+    std::int64_t shoes = 50000;
+    /** Cards dealt between two situations played out. */
+    std::int32_t sample_interval = 3;
+    std::uint64_t seed = 0x5eed;
+    std::int32_t threads = hardware_threads();
+};
+
+/**
+ * @brief Simulate the index of every deviation for a counting system.
+ *
+ * Each situation is played out both ways with the same cards at many
+ * depths of random shoes. The difference of the results is fit linearly
+ * against the true count, as the engine reports it, and the index is where
+ * the fit crosses zero, rounded. As in evaluate(), the result only depends
+ * on the parameters, not on the thread count.
+ *
+ * @param scale fixed point scale of @p weights, see Strategy
+ * @return nothing if @p cancel was set before the run completed
+ */
+[[nodiscard]] std::optional<IndexTable> compute_indices(
+    const Weights& weights, std::int32_t scale = 1,
+    const IndexParameters& parameters = {},
+    const std::atomic<bool>* cancel = nullptr
+);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_DEVIATIONS_HPP
@@ -0,0 +1,114 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_DISTRIBUTION_HPP
+#define CARD_COUNTER_CORE_DISTRIBUTION_HPP
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+// own
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** Probabilities of consecutive integer values. */
+struct Distribution {
+    /** Probability of @p value, zero outside the range. */
+    [[nodiscard]] double at(std::int32_t value) const noexcept;
+
+    /** Probability of a value not below @p value. */
+    [[nodiscard]] double at_least(std::int32_t value) const noexcept;
+
+    [[nodiscard]] double mean() const noexcept;
+
+    [[nodiscard]] double variance() const noexcept;
+
+    /** Value of probabilities[0]. */
+    std::int32_t offset = 0;
+    std::vector<double> probabilities;
+};
+
+/**
+ * @brief Exact distribution of the running count over a whole shoe.
+ *
+ * The cards seen after n cards are a multivariate hypergeometric draw from
+ * the shoe. Ranks with the same weight are merged, and each group adds a
+ * polynomial sum_k C(c, k) x^k y^(w k) to the product, where c is the size
+ * of the group. The product is kept as a table of cards seen by running
+ * count, so one pass answers every penetration. The rows are contiguous,
+ * which lets the compiler vectorise the convolution.
+ *
+ * The coefficients are binomials in double precision, which covers shoes
+ * of up to max_decks decks.
+ */
+class CountDistribution {
+public:
+    static constexpr std::int32_t max_decks = 16;
+    /** Tables get() keeps, the least recently used one is dropped. */
+    static constexpr std::size_t cache_size = 8;
+
+    CountDistribution(const Weights& weights, std::int32_t deck_count);
+
+    /**
+     * @brief Shared table for @p weights and @p deck_count.
+     *
+     * Tables only depend on the multiset of weights, so strategies that
+     * differ by the order of their weights share one. Building a table of
+     * fine weights takes a while, call it off the GUI thread.
+     */
+    [[nodiscard]] static std::shared_ptr<const CountDistribution>
+    get(const Weights& weights, std::int32_t deck_count);
+
+    [[nodiscard]] std::int32_t total_cards() const noexcept { return cards; }
+
+    /** Running count after @p dealt cards of the shoe. */
+    [[nodiscard]] Distribution running_count(std::int32_t dealt) const;
+
+    /**
+     * @brief True count after @p dealt cards.
+     *
+     * The running count divided by the remaining decks, rounded down.
+     * Unbalanced counts are not corrected for their drift. For fixed point
+     * weights pass their @p scale so the true count comes out in points.
+     */
+    [[nodiscard]] Distribution
+    true_count(std::int32_t dealt, std::int32_t scale = 1) const;
+
+    /** Cards dealt at the given share of the shoe. */
+    [[nodiscard]] std::int32_t at_penetration(double penetration) const;
+
+private:
+    std::int32_t cards = 0;
+    std::int32_t min_count = 0;
+    std::int32_t width = 1;
+    /** Unnormalised weights, (cards + 1) rows of width entries. */
+    std::vector<double> table;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_DISTRIBUTION_HPP
@@ -0,0 +1,352 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_ENGINE_HPP
+#define CARD_COUNTER_CORE_ENGINE_HPP
+
+// std
+#include <cstdint>
+#include <span>
+#include <vector>
+// own
+#include "core/blackjack.hpp"
+#include "core/continuousshoe.hpp"
+#include "core/counterset.hpp"
+#include "core/deviations.hpp"
+#include "core/random.hpp"
+#include "core/shoe.hpp"
+#include "core/slotsampler.hpp"
+#include "core/slotset.hpp"
+#include "core/strategy.hpp"
+#include "core/truecount.hpp"
+
+namespace core {
+
+/**
+ * @brief Receiver of the events an Engine produces while dealing.
+ *
+ * Callbacks run synchronously from inside the engine call that caused them;
+ * they may query the engine but must not add or remove slots.
+ */
+class EngineObserver {
+public:
+    virtual ~EngineObserver() = default;
+
+    /** A card was dealt, the running count already includes it. */
+    virtual void card_dealt(std::int32_t handle, std::int32_t card);
+
+    /** A joker was dealt; the slot waits for @ref Engine::answer. */
+    virtual void joker_dealt(std::int32_t handle);
+
+    /** The slot ran out of cards and waits for @ref Engine::reshuffle. */
+    virtual void shoe_finished(std::int32_t handle);
+
+    /** The last card settled the blackjack round of the slot. */
+    virtual void round_finished(std::int32_t handle);
+};
+
+/**
+ * @brief Headless game state of a table.
+ *
+ * Slots are addressed by stable handles. Their state is kept as a structure
+ * of arrays indexed by handle, and the scheduling sets only store handles,
+ * so dealing touches a few contiguous arrays and never allocates once the
+ * shoes are filled.
+ *
+ * Besides its main count a slot may keep side counts, all updated together
+ * through a CounterSet; a joker asks for one of them at random. Every slot
+ * also tallies the ranks it was dealt, so the count under any strategy is
+ * known without replaying the shoe.
+ *
+ * A slot is fake until it is activated, a placeholder the player can turn
+ * into a real one. An active slot is available for dealing unless it ran
+ * out of cards or waits for the answer to a joker.
+ */
+class Engine {
+public:
+    enum class mode { Ordered, Simultaneous, Random, Adaptive };
+
+    explicit Engine(std::uint64_t seed = Random::entropy());
+
+    void set_observer(EngineObserver* value) noexcept { observer = value; }
+
+    /** Restart the random sequence used for shuffling and scheduling. */
+    void seed(std::uint64_t value) noexcept { rng.seed(value); }
+
+    void set_mode(mode value) noexcept { current_mode = value; }
+
+    [[nodiscard]] mode get_mode() const noexcept { return current_mode; }
+
+    /** Deal random cards with replacement instead of from the shoes. */
+    void set_infinite(bool value) noexcept { infinite = value; }
+
+    [[nodiscard]] bool is_infinite() const noexcept { return infinite; }
+
+    /**
+     * @brief Deal from continuous shuffling machines instead of the shoes.
+     *
+     * Takes effect at the next reshuffle; the machines never run out.
+     * The infinite mode takes precedence.
+     */
+    void set_continuous(bool value) noexcept { continuous = value; }
+
+    [[nodiscard]] bool is_continuous() const noexcept { return continuous; }
+
+    /** Cards dealt before a discard goes back into the machine. */
+    void set_shuffle_delay(std::int32_t value) noexcept {
+        shuffle_delay = value;
+    }
+
+    [[nodiscard]] std::int32_t get_shuffle_delay() const noexcept {
+        return shuffle_delay;
+    }
+
+    /**
+     * @brief Play blackjack rounds with the standard cards every slot deals.
+     *
+     * Takes effect at the next reshuffle or restart; see BlackjackRound.
+     * @param value players per slot, 0 only counts
+     */
+    void set_round_seats(std::int32_t value) noexcept { round_seats = value; }
+
+    [[nodiscard]] std::int32_t get_round_seats() const noexcept {
+        return round_seats;
+    }
+
+    /** Weighting of slots in the adaptive mode. */
+    void set_policy(SlotSampler::policy value);
+
+    /** Remove all slots. */
+    void clear();
+
+    /**
+     * @brief Start over with the same slots.
+     *
+     * Running counts, pending jokers, finished shoes and the scheduling
+     * state are reset; shoes keep their cards until they are reshuffled.
+     */
+    void restart();
+
+    /**
+     * @brief Create a slot at the end of the table.
+     * @return its handle, handles of removed slots are reused
+     */
+    std::int32_t add_slot(bool active = false);
+
+    void remove_slot(std::int32_t handle);
+
+    /** Exchange the table positions of two slots. */
+    void swap_slots(std::int32_t first, std::int32_t second);
+
+    /** Handles in table order. */
+    [[nodiscard]] const std::vector<std::int32_t>& get_order() const noexcept {
+        return order;
+    }
+
+    [[nodiscard]] std::int32_t slot_count() const noexcept {
+        return static_cast<std::int32_t>(order.size());
+    }
+
+    /** Turn a fake slot into a real one with a zero running count. */
+    void activate(std::int32_t handle);
+
+    /**
+     * @brief Replace the main count's strategy.
+     *
+     * The running count becomes what the new strategy would have counted
+     * for the cards dealt so far.
+     */
+    void set_strategy(std::int32_t handle, const Strategy& strategy);
+
+    /**
+     * @brief Replace the side counts of a slot.
+     *
+     * Like the main count they start from the cards dealt so far;
+     * strategies beyond CounterSet::max_counters - 1 are ignored.
+     */
+    void set_side_counts(
+        std::int32_t handle, std::span<const Strategy> side_counts
+    );
+
+    /** Number of counts the slot keeps, the main count included. */
+    [[nodiscard]] std::int32_t get_counter_count(std::int32_t handle) const;
+
+    void set_deck_count(std::int32_t handle, std::int32_t deck_count);
+
+    /**
+     * @brief Refill the shoe of a slot.
+     *
+     * A finished active slot becomes available again.
+     */
+    void reshuffle(std::int32_t handle);
+
+    /** Deal the next card to a slot, whether available or not. */
+    void deal(std::int32_t handle);
+
+    /**
+     * @brief Deal according to the current mode.
+     * @return false if no slot is available
+     */
+    bool tick();
+
+    /**
+     * @brief Check the running count given for a pending joker.
+     *
+     * The answer is compared with the counter the joker asks for. The slot
+     * becomes available again whatever the answer.
+     * @return whether @p running_count was right
+     */
+    bool answer(std::int32_t handle, std::int32_t running_count);
+
+    /**
+     * @brief Check the true count given for a pending joker.
+     *
+     * Like answer(), but compares with the asked counter's true count
+     * rounded as given.
+     */
+    bool answer_true_count(
+        std::int32_t handle, std::int32_t true_count, Rounding rounding
+    );
+
+    /**
+     * @brief Check the play given for a deviation at a pending joker.
+     *
+     * The right play follows from the asked counter's true count, rounded
+     * as given, against @p index.
+     */
+    bool answer_play(
+        std::int32_t handle, const Deviation& deviation, std::int8_t index,
+        Play play, Rounding rounding
+    );
+
+    [[nodiscard]] bool is_fake(std::int32_t handle) const;
+
+    [[nodiscard]] bool is_available(std::int32_t handle) const;
+
+    [[nodiscard]] bool is_quizzing(std::int32_t handle) const;
+
+    [[nodiscard]] bool is_finished(std::int32_t handle) const;
+
+    /** Running count of a counter, 0 being the main count. */
+    [[nodiscard]] std::int32_t
+    get_running_count(std::int32_t handle, std::int32_t counter = 0) const;
+
+    /** Ranks dealt to the slot since its counts last started from zero. */
+    [[nodiscard]] const RankCounts& get_rank_counts(std::int32_t handle
+    ) const;
+
+    /** Running count the slot would have under @p strategy, in O(13). */
+    [[nodiscard]] std::int32_t
+    count_with(std::int32_t handle, const Strategy& strategy) const;
+
+    /**
+     * @brief True count of a counter in points, see core::true_count().
+     *
+     * Without a shoe, as in the infinite and the continuous modes, one
+     * deck is taken to be left.
+     */
+    [[nodiscard]] double
+    get_true_count(std::int32_t handle, std::int32_t counter = 0) const;
+
+    /** Counter the pending or last joker of the slot asks for. */
+    [[nodiscard]] std::int32_t get_quizzed_counter(std::int32_t handle) const;
+
+    /** Card shown by the slot, -1 before the first deal. */
+    [[nodiscard]] std::int32_t get_current_card(std::int32_t handle) const;
+
+    [[nodiscard]] std::int32_t get_deck_count(std::int32_t handle) const;
+
+    [[nodiscard]] const Strategy&
+    get_strategy(std::int32_t handle, std::int32_t counter = 0) const;
+
+    [[nodiscard]] const Shoe& get_shoe(std::int32_t handle) const;
+
+    [[nodiscard]] const ContinuousShoe&
+    get_machine(std::int32_t handle) const;
+
+    /** Round in progress, or the last one until the next card. */
+    [[nodiscard]] const BlackjackRound& get_round(std::int32_t handle) const;
+
+    [[nodiscard]] std::int32_t available_count() const noexcept {
+        return available.size();
+    }
+
+    /** Whether any slot waits for a joker answer. */
+    [[nodiscard]] bool has_pending_jokers() const noexcept {
+        return !jokers.empty();
+    }
+
+private:
+    enum flag : std::uint8_t {
+        Used = 1 << 0,
+        Active = 1 << 1,
+        Finished = 1 << 2,
+    };
+
+    [[nodiscard]] bool has_flag(std::int32_t handle, flag value) const;
+
+    void set_flag(std::int32_t handle, flag value, bool on);
+
+    void set_available(std::int32_t handle, bool value);
+
+    /** Release a pending joker after an answer. */
+    bool settle(std::int32_t handle, bool correct);
+
+    void update_positions(std::size_t from);
+
+    [[nodiscard]] std::int32_t pick_next();
+
+    std::vector<std::uint8_t> flags;
+    /** Running counts of all counters, packed as by CounterSet. */
+    std::vector<CounterSet::Counts> running_counts;
+    std::vector<std::int32_t> current_cards;
+    std::vector<std::int32_t> deck_counts;
+    std::vector<std::int32_t> positions;
+    std::vector<std::int32_t> quizzed_counters;
+    std::vector<CounterSet> counters;
+    std::vector<RankCounts> rank_counts;
+    std::vector<Shoe> shoes;
+    std::vector<ContinuousShoe> machines;
+    std::vector<BlackjackRound> rounds;
+
+    std::vector<std::int32_t> order;
+    std::vector<std::int32_t> free_handles;
+    SlotSet available;
+    SlotSet jokers;
+    SlotSampler sampler;
+    Random rng;
+
+    EngineObserver* observer = nullptr;
+    mode current_mode = mode::Ordered;
+    bool infinite = false;
+    bool continuous = false;
+    std::int32_t shuffle_delay = 20;
+    std::int32_t round_seats = 0;
+    std::int32_t order_index = 0;
+    std::int32_t last_picked = -1;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_ENGINE_HPP
@@ -0,0 +1,104 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_EVALUATOR_HPP
+#define CARD_COUNTER_CORE_EVALUATOR_HPP
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+// own
+#include "core/parallel.hpp"
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** Conditions a strategy is simulated under. */
+struct EvaluationParameters {
+    std::int32_t deck_count = 6;
+    /** Share of the shoe dealt before the reshuffle. */
+    double penetration = 0.75;
+    /** Number of shoes to deal; more shoes give tighter estimates. */
+    std::int64_t shoes = 100000;
+    /** Cards dealt between two samples, roughly one round. */
+    std::int32_t sample_interval = 10;
+    /** The same seed deals the same shoes to every strategy. */
+    std::uint64_t seed = 0x5eed;
+    std::int32_t threads = hardware_threads();
+};
+
+/** Quality of a strategy, each correlation in [-1, 1]. */
+struct Evaluation {
+    /**
+     * Correlation of the true count with the change of the player
+     * advantage, following Griffin's effects of removal.
+     */
+    double betting_correlation = 0.0;
+    /** Mean correlation with the stand and double decisions. */
+    double playing_efficiency = 0.0;
+    /** Correlation with the insurance bet. */
+    double insurance_correlation = 0.0;
+    /** Variance of the true count at the sampled points. */
+    double count_variance = 0.0;
+    std::int64_t samples = 0;
+};
+
+/**
+ * @brief Deal random shoes and measure how well @p weights track the game.
+ *
+ * At every sample point the true count is compared with the ideal count of
+ * each decision, the sum of the effects of removal of the cards seen so
+ * far. The shoes are split into fixed blocks with their own seeds, so the
+ * result only depends on the parameters, not on the thread count.
+ *
+ * @return nothing if @p cancel was set before the run completed
+ */
+[[nodiscard]] std::optional<Evaluation> evaluate(
+    const Weights& weights, const EvaluationParameters& parameters = {},
+    const std::atomic<bool>* cancel = nullptr
+);
+
+/**
+ * @brief Evaluations by weight vector, safe to share between threads.
+ *
+ * The parameters are not part of the key; a cache is meant to be used
+ * with one set of parameters.
+ */
+class EvaluationCache {
+public:
+    [[nodiscard]] std::optional<Evaluation> find(const Weights& weights) const;
+
+    void insert(const Weights& weights, const Evaluation& evaluation);
+
+private:
+    mutable std::mutex mutex;
+    std::map<Weights, Evaluation> evaluations;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_EVALUATOR_HPP
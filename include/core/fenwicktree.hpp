@@ -0,0 +1,85 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_FENWICKTREE_HPP
+#define CARD_COUNTER_CORE_FENWICKTREE_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Binary indexed tree over non-negative weights.
+ *
+ * Supports point updates, prefix sums and weighted sampling (finding the
+ * index whose cumulative weight covers a given value) in O(log n).
+ */
+class FenwickTree {
+public:
+    /**
+     * @brief Change the number of weights.
+     *
+     * New weights are zero. The tree is rebuilt in O(n).
+     */
+    void resize(std::int32_t size);
+
+    [[nodiscard]] std::int32_t size() const noexcept;
+
+    /** Replace the weight at @p index. */
+    void set(std::int32_t index, double weight);
+
+    [[nodiscard]] double weight(std::int32_t index) const;
+
+    /** Sum of all weights. */
+    [[nodiscard]] double total() const;
+
+    /**
+     * @brief Index whose cumulative range contains @p value.
+     *
+     * For a value in [0, total()) returns the smallest index i such that
+     * the sum of weights 0..i exceeds @p value. Values outside that range
+     * are clamped to the first or last index.
+     */
+    [[nodiscard]] std::int32_t find(double value) const;
+
+    /**
+     * @brief Replace all weights at once.
+     *
+     * Rebuilds the tree in O(n), which also discards the rounding error
+     * accumulated by point updates.
+     */
+    void assign(std::vector<double> values);
+
+private:
+    void rebuild();
+
+    std::vector<double> weights;
+    std::vector<double> tree;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_FENWICKTREE_HPP
@@ -0,0 +1,77 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_HISTOGRAM_HPP
+#define CARD_COUNTER_CORE_HISTOGRAM_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Counts of integer values, such as running counts or gaps.
+ *
+ * Bins cover the range between the smallest and the largest value seen and
+ * grow on demand, so the histogram stays small for the narrow distributions
+ * a simulation produces.
+ */
+class Histogram {
+public:
+    void add(std::int32_t value, std::int64_t times = 1);
+
+    /** Add the counts of another histogram. */
+    void merge(const Histogram& other);
+
+    /** Number of values added. */
+    [[nodiscard]] std::int64_t count() const noexcept { return total; }
+
+    /** How often @p value was added. */
+    [[nodiscard]] std::int64_t at(std::int32_t value) const noexcept;
+
+    /** Smallest value seen; the histogram must not be empty. */
+    [[nodiscard]] std::int32_t min() const noexcept { return offset; }
+
+    /** Largest value seen; the histogram must not be empty. */
+    [[nodiscard]] std::int32_t max() const noexcept {
+        return offset + static_cast<std::int32_t>(bins.size()) - 1;
+    }
+
+    [[nodiscard]] double mean() const noexcept;
+
+    [[nodiscard]] double variance() const noexcept;
+
+    /** Smallest value v with P(X <= v) >= @p probability. */
+    [[nodiscard]] std::int32_t quantile(double probability) const noexcept;
+
+private:
+    std::vector<std::int64_t> bins;
+    std::int32_t offset = 0;
+    std::int64_t total = 0;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_HISTOGRAM_HPP
@@ -0,0 +1,133 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_LIBRARY_HPP
+#define CARD_COUNTER_CORE_LIBRARY_HPP
+
+// std
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+// own
+#include "core/strategy.hpp"
+
+namespace core {
+
+/** One strategy of a library file. */
+struct LibraryEntry {
+    std::string name;
+    /** Markdown, may span several lines. */
+    std::string description;
+    /** In units of 1 / scale points, see Strategy. */
+    Weights weights {};
+    std::int32_t scale = 1;
+};
+
+/**
+ * @brief Convert weights written in points to fixed point.
+ *
+ * Each text is a decimal such as "-1", "+0.5" or "1.25" within max_weight.
+ * The scale becomes the smallest of 1, 2 and 4 that makes every weight
+ * whole.
+ * @return false if a text is malformed or out of range, or the weights
+ *         need a finer scale than max_scale
+ */
+bool parse_points(
+    std::span<const std::string_view, rank_count> texts, Weights& weights,
+    std::int32_t& scale
+);
+
+/** Format a fixed point weight or count in points, e.g. "-1.5". */
+[[nodiscard]] std::string format_points(std::int32_t value, std::int32_t scale);
+
+/**
+ * @brief Streaming reader for strategy libraries in CSV.
+ *
+ * Each record holds a name, a description and the 13 weights of Ace..King
+ * in points, quoted as in RFC 4180 where needed. A first record starting
+ * with "name" is taken as the header. Records are checked as they are
+ * read: the name must not be empty and the weights must pass
+ * parse_points().
+ */
+class LibraryReader {
+public:
+    explicit LibraryReader(std::istream& input);
+
+    /** Next strategy, or nothing at the end of the input or on an error. */
+    [[nodiscard]] std::optional<LibraryEntry> next();
+
+    /** Why next() failed, empty if the input simply ended. */
+    [[nodiscard]] const std::string& get_error() const noexcept {
+        return error;
+    }
+
+    /** Line the last record started on, counting from 1. */
+    [[nodiscard]] std::size_t get_line() const noexcept {
+        return record_line;
+    }
+
+private:
+    /** Split the next record into fields, false at the end or on errors. */
+    bool read_record();
+
+    bool fail(std::string message);
+
+    std::streambuf* input;
+    std::vector<std::string> fields;
+    std::string error;
+    std::size_t line = 1;
+    std::size_t record_line = 0;
+    bool header_checked = false;
+};
+
+/** Streaming writer for the format read by LibraryReader. */
+class LibraryWriter {
+public:
+    /** Starts the output with the header record. */
+    explicit LibraryWriter(std::ostream& output);
+
+    void write(const LibraryEntry& entry);
+
+private:
+    void write_field(std::string_view field);
+
+    std::ostream& output;
+};
+
+/**
+ * @brief Read a whole library.
+ *
+ * @return the entries, or nothing with @p error set if any record is
+ *         invalid
+ */
+[[nodiscard]] std::optional<std::vector<LibraryEntry>>
+read_library(std::istream& input, std::string& error);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_LIBRARY_HPP
@@ -0,0 +1,89 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_OPTIMISER_HPP
+#define CARD_COUNTER_CORE_OPTIMISER_HPP
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+// own
+#include "core/evaluator.hpp"
+
+namespace core {
+
+/** Search space and schedule of the optimiser. */
+struct OptimiserParameters {
+    OptimiserParameters() { evaluation.shoes = 20000; }
+
+    /** Largest absolute weight allowed, the level of the count. */
+    std::int32_t level = 2;
+    /** Keep the weights of a full deck summing to zero. */
+    bool balanced = true;
+    std::int32_t steps = 400;
+    /** Number of distinct results returned. */
+    std::size_t keep = 5;
+    double start_temperature = 0.01;
+    double end_temperature = 0.0002;
+    /** Every candidate is dealt the same shoes from this. */
+    EvaluationParameters evaluation;
+    std::uint64_t seed = 0x0b7;
+};
+
+/** A weight vector and its betting correlation. */
+struct Candidate {
+    Weights weights {};
+    double score = 0.0;
+};
+
+/** Called after every step with the best candidate so far. */
+using OptimiserProgress
+    = std::function<void(std::int32_t step, const Candidate& best)>;
+
+/**
+ * @brief Search for the weights with the highest betting correlation.
+ *
+ * Simulated annealing over weights in [-level, level], with the ten-valued
+ * ranks tied together. Every candidate is evaluated with the same seed, so
+ * two candidates are compared on the same shoes and the noise of the
+ * simulation mostly cancels out. Each evaluation uses all threads given in
+ * the evaluation parameters.
+ *
+ * Weights are kept divided by their greatest common divisor, since a
+ * correlation does not change when all weights are scaled.
+ *
+ * @return the best distinct candidates, best first; when cancelled, the
+ *         best ones found so far
+ */
+[[nodiscard]] std::vector<Candidate> optimise(
+    const OptimiserParameters& parameters,
+    const OptimiserProgress& progress = {},
+    const std::atomic<bool>* cancel = nullptr
+);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_OPTIMISER_HPP
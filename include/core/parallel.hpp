@@ -0,0 +1,70 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_PARALLEL_HPP
+#define CARD_COUNTER_CORE_PARALLEL_HPP
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace core {
+
+/** Number of hardware threads, at least one. */
+[[nodiscard]] std::int32_t hardware_threads() noexcept;
+
+/**
+ * @brief Body of a parallel loop.
+ *
+ * Called with the index of the worker running it and a half-open range
+ * [begin, end) of the iteration space. A worker index is only ever used by
+ * one thread at a time, so per-worker scratch data needs no locking.
+ */
+using ParallelBody = std::function<
+    void(std::int32_t worker, std::int64_t begin, std::int64_t end)>;
+
+/**
+ * @brief Run @p body over [0, count) on up to @p threads workers.
+ *
+ * The range is cut into chunks of @p grain iterations, which are handed
+ * out to the workers in contiguous blocks. A worker that runs out of work
+ * steals the upper half of the largest block left, so uneven chunks keep
+ * all cores busy without a central queue. The calling thread is worker 0,
+ * the others come from a pool of hardware_threads() - 1 threads that lives
+ * as long as the process. Overlapping calls share the pool, a worker that
+ * is not free in time leaves its chunks to be stolen by the others.
+ *
+ * @param cancel polled between chunks; once set, the remaining chunks are
+ *               skipped
+ * @return false if the loop was cancelled
+ */
+bool parallel_for(
+    std::int64_t count, std::int64_t grain, std::int32_t threads,
+    const ParallelBody& body, const std::atomic<bool>* cancel = nullptr
+);
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_PARALLEL_HPP
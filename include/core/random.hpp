@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_RANDOM_HPP
+#define CARD_COUNTER_CORE_RANDOM_HPP
+
+// std
+#include <array>
+#include <cstdint>
+
+namespace core {
+
+/**
+ * @brief Small and fast pseudo random generator (xoshiro256**).
+ *
+ * Satisfies UniformRandomBitGenerator, so it can be passed to the standard
+ * algorithms. Every engine and every simulation worker owns its own
+ * instance; there is no shared state and no locking.
+ */
+class Random {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Random(std::uint64_t seed = 0x9e3779b97f4a7c15ULL) noexcept;
+
+    /** Reset the state from a 64 bit seed. */
+    void seed(std::uint64_t value) noexcept;
+
+    /** A seed drawn from the operating system entropy source. */
+    [[nodiscard]] static std::uint64_t entropy();
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+
+    [[nodiscard]] static constexpr result_type max() noexcept {
+        return UINT64_MAX;
+    }
+
+    result_type operator()() noexcept {
+        const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Uniformly distributed integer in [0, bound).
+     *
+     * Uses Lemire's multiply-and-reject method; @p bound must be positive.
+     */
+    std::int32_t bounded(std::int32_t bound) noexcept;
+
+    /** Uniformly distributed double in [0, 1). */
+    double uniform() noexcept {
+        return static_cast<double>(operator()() >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief Advance the state by 2^128 steps.
+     *
+     * Gives non-overlapping streams for parallel workers that start from
+     * the same seed.
+     */
+    void jump() noexcept;
+
+private:
+    static constexpr std::uint64_t rotl(
+        const std::uint64_t x, const int k
+    ) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<std::uint64_t, 4> state {};
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_RANDOM_HPP
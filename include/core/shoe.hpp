@@ -0,0 +1,147 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_SHOE_HPP
+#define CARD_COUNTER_CORE_SHOE_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+// own
+#include "core/cards.hpp"
+#include "core/random.hpp"
+
+namespace core {
+
+/**
+ * @brief Shuffle @p deck_count decks into @p deck, spacing the jokers.
+ *
+ * The distance between the start of the shoe and the first joker, and
+ * between two consecutive jokers, is at least
+ * `deck_size / shuffle_coefficient` cards. The result is distributed
+ * exactly like a uniform shuffle conditioned on that spacing, but instead of
+ * rejecting shuffles until one fits, a valid joker placement is drawn
+ * directly and the remaining cards are shuffled around it, so the cost is
+ * linear in the number of cards.
+ *
+ * If the spacing cannot be satisfied the cards are shuffled uniformly.
+ *
+ * @param deck storage for the result, its capacity is reused
+ */
+void shuffle_shoe(
+    std::vector<std::int32_t>& deck, std::int32_t deck_count,
+    std::int32_t shuffle_coefficient, Random& rng
+);
+
+/**
+ * @brief Draw a card for infinity mode.
+ *
+ * Cards are drawn with replacement, but repeating the suit or the rank of
+ * the previous card is made less likely, more so for slots further down
+ * the table.
+ *
+ * @param last       previously shown card or -1
+ * @param slot_index position of the slot on the table
+ * @param slot_count number of slots on the table
+ */
+[[nodiscard]] std::int32_t infinite_card(
+    std::int32_t last, std::int32_t slot_index, std::int32_t slot_count,
+    Random& rng
+);
+
+/**
+ * @brief Cards of one table slot, dealt from the front.
+ *
+ * The shoe keeps the ranks it still holds up to date as cards are drawn,
+ * so the remaining composition and the decks left are known in O(1)
+ * without scanning the cards.
+ */
+class Shoe {
+public:
+    /** Replace the contents with freshly shuffled decks. */
+    void fill(
+        std::int32_t deck_count, Random& rng,
+        std::int32_t shuffle_coefficient = 2
+    );
+
+    void clear() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept {
+        return position == cards.size();
+    }
+
+    /** Take the next card; the shoe must not be empty. */
+    std::int32_t draw() noexcept {
+        const std::int32_t card = cards[position++];
+        if (!is_joker(card)) {
+            --ranks_left[static_cast<std::size_t>(rank_of(card) - Ace)];
+            --standard_left;
+        }
+        return card;
+    }
+
+    /** Number of cards the shoe was filled with. */
+    [[nodiscard]] std::int32_t size() const noexcept {
+        return static_cast<std::int32_t>(cards.size());
+    }
+
+    [[nodiscard]] std::int32_t remaining() const noexcept {
+        return static_cast<std::int32_t>(cards.size() - position);
+    }
+
+    /** Standard cards of each rank Ace..King not dealt yet. */
+    [[nodiscard]] const RankCounts& get_ranks_left() const noexcept {
+        return ranks_left;
+    }
+
+    /** Standard cards not dealt yet, jokers aside. */
+    [[nodiscard]] std::int32_t standard_remaining() const noexcept {
+        return standard_left;
+    }
+
+    /** Decks left to deal, counting standard cards only. */
+    [[nodiscard]] double decks_remaining() const noexcept {
+        return static_cast<double>(standard_left)
+            / (deck_size - jokers_per_deck);
+    }
+
+    /** Share of the standard cards dealt, from 0 to 1. */
+    [[nodiscard]] double penetration() const noexcept;
+
+    /** All cards in dealing order, including the dealt ones. */
+    [[nodiscard]] const std::vector<std::int32_t>& contents() const noexcept {
+        return cards;
+    }
+
+private:
+    std::vector<std::int32_t> cards;
+    std::size_t position = 0;
+    RankCounts ranks_left {};
+    std::int32_t standard_left = 0;
+    std::int32_t standard_total = 0;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_SHOE_HPP
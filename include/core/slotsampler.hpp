@@ -0,0 +1,113 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_SLOTSAMPLER_HPP
+#define CARD_COUNTER_CORE_SLOTSAMPLER_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+// own
+#include "core/fenwicktree.hpp"
+
+namespace core {
+
+class Random;
+
+/**
+ * @brief Weighted random choice of the next table slot.
+ *
+ * Every active slot carries a weight derived from the chosen policy: the
+ * recent error rate of the joker answers in that slot, the time since the
+ * slot was last dealt, or both. Weights live in a Fenwick tree, so a deal,
+ * an answer and a draw each cost O(log n).
+ *
+ * Staleness grows exponentially with the number of ticks since the last
+ * deal. Since every slot ages by the same factor on each tick, the common
+ * factor is left out and only the slot that was dealt gets updated; the
+ * stored weights are renormalised once in a while, which keeps the
+ * amortised cost logarithmic.
+ */
+class SlotSampler {
+public:
+    enum class policy { Uniform = 0, ErrorRate, Staleness, Mixed };
+
+    void set_policy(policy value);
+
+    [[nodiscard]] policy get_policy() const noexcept;
+
+    /** Forget all slots and statistics. */
+    void clear();
+
+    /**
+     * @brief Include the slot in or exclude it from sampling.
+     *
+     * Statistics of an excluded slot are kept.
+     */
+    void set_active(std::int32_t handle, bool active);
+
+    /** Drop statistics of a handle that is about to be reused. */
+    void forget(std::int32_t handle);
+
+    /** Record that a card was dealt to the slot. */
+    void dealt(std::int32_t handle);
+
+    /** Record a joker answer given in the slot. */
+    void answered(std::int32_t handle, bool correct);
+
+    /**
+     * @brief Draw an active slot proportionally to its weight.
+     * @return the handle or -1 if no slot is active
+     */
+    [[nodiscard]] std::int32_t pick(Random& rng) const;
+
+private:
+    struct slot_stats {
+        bool active = false;
+        double error_rate = 0.0;
+        std::int64_t last_dealt = 0;
+    };
+
+    void ensure(std::int32_t handle);
+
+    [[nodiscard]] double weight_of(const slot_stats& slot) const;
+
+    void update(std::int32_t handle);
+
+    void renormalise();
+
+    policy current_policy = policy::Uniform;
+    std::vector<slot_stats> stats;
+    FenwickTree tree;
+    std::int32_t active_count = 0;
+    /** Number of active slots the staleness decay was derived from. */
+    std::int32_t decay_count = 0;
+    std::int64_t tick = 0;
+    std::int64_t epoch = 0;
+    double decay = 0.0;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_SLOTSAMPLER_HPP
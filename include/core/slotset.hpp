@@ -0,0 +1,102 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_SLOTSET_HPP
+#define CARD_COUNTER_CORE_SLOTSET_HPP
+
+// std
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+class Random;
+
+/**
+ * @brief Dense set of table slot handles.
+ *
+ * Members are packed into an array and a reverse index maps every handle to
+ * its position, so insert, erase, membership test and uniform random pick
+ * are all O(1). Erasing moves the last member into the freed position, which
+ * means the iteration order changes whenever a member is removed.
+ */
+class SlotSet {
+public:
+    /**
+     * @brief Add a handle to the set.
+     * @return false if the handle was already a member
+     */
+    bool insert(std::int32_t handle);
+
+    /**
+     * @brief Remove a handle from the set.
+     * @return false if the handle was not a member
+     */
+    bool erase(std::int32_t handle);
+
+    [[nodiscard]] bool contains(std::int32_t handle) const noexcept;
+
+    [[nodiscard]] std::int32_t size() const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+
+    void clear();
+
+    /** Member stored at the given dense position. */
+    [[nodiscard]] std::int32_t at(std::int32_t index) const;
+
+    /**
+     * @brief Pick a uniformly distributed member.
+     *
+     * The set must not be empty.
+     */
+    [[nodiscard]] std::int32_t pick(Random& rng) const;
+
+    /**
+     * @brief Pick a uniformly distributed member other than @p handle.
+     *
+     * Falls back to @ref pick if @p handle is not a member or is the only
+     * one.
+     */
+    [[nodiscard]] std::int32_t
+    pick_other(std::int32_t handle, Random& rng) const;
+
+    [[nodiscard]] std::vector<std::int32_t>::const_iterator
+    begin() const noexcept {
+        return members.cbegin();
+    }
+
+    [[nodiscard]] std::vector<std::int32_t>::const_iterator
+    end() const noexcept {
+        return members.cend();
+    }
+
+private:
+    std::vector<std::int32_t> members;
+    std::vector<std::int32_t> positions;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_SLOTSET_HPP
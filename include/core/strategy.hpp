@@ -0,0 +1,137 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_STRATEGY_HPP
+#define CARD_COUNTER_CORE_STRATEGY_HPP
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+// own
+#include "core/cards.hpp"
+
+namespace core {
+
+/** Weights of a counting strategy for the ranks Ace..King. */
+using Weights = std::array<std::int32_t, rank_count>;
+
+/** Largest absolute weight a strategy may use, in points. */
+constexpr std::int32_t max_weight = 5;
+
+/** Finest fraction of a point a weight may use: quarters. */
+constexpr std::int32_t max_scale = 4;
+
+/**
+ * @brief Weights of a card counting strategy.
+ *
+ * Holds the numbers only, names and descriptions stay with the widgets.
+ * The weights are stored by value so a slot can keep its own copy next to
+ * the rest of its state.
+ *
+ * Weights are fixed point: a weight w counts w / scale points, so a
+ * Halves count stores +0.5 as 1 with a scale of 2. Running counts stay
+ * integers in the same units and only the display divides by the scale.
+ */
+class Strategy {
+public:
+    Strategy() = default;
+
+    /** @param scale units per point, from 1 to max_scale */
+    constexpr explicit Strategy(
+        const Weights& weights, const std::int32_t scale = 1
+    ) noexcept
+        : weights(weights)
+        , scale(scale) { }
+
+    /** Weight of a card rank in Ace..King. */
+    [[nodiscard]] constexpr std::int32_t
+    get_weight(const std::int32_t rank) const {
+        return weights[static_cast<std::size_t>(rank - Ace)];
+    }
+
+    [[nodiscard]] constexpr const Weights& get_weights() const noexcept {
+        return weights;
+    }
+
+    /** Units per point. */
+    [[nodiscard]] constexpr std::int32_t get_scale() const noexcept {
+        return scale;
+    }
+
+    /** Running count after a card of the given rank. */
+    [[nodiscard]] constexpr std::int32_t
+    update(const std::int32_t count, const std::int32_t rank) const {
+        return count + get_weight(rank);
+    }
+
+    /**
+     * @brief Running count after the given cards, in any order.
+     *
+     * A dot product of 13 terms, however many cards were dealt.
+     */
+    [[nodiscard]] constexpr std::int32_t
+    count(const RankCounts& dealt) const noexcept {
+        std::int32_t sum = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            sum += weights[i] * dealt[i];
+        }
+        return sum;
+    }
+
+    /** Running count at the end of a full deck, zero for balanced counts. */
+    [[nodiscard]] constexpr std::int32_t deck_sum() const noexcept {
+        std::int32_t sum = 0;
+        for (const std::int32_t weight : weights) {
+            sum += weight;
+        }
+        return 4 * sum;
+    }
+
+    [[nodiscard]] constexpr bool is_balanced() const noexcept {
+        return !deck_sum();
+    }
+
+    /**
+     * @brief Largest absolute weight in units.
+     *
+     * A level two count uses weights up to 2; Halves, with weights up to
+     * 1.5 points in halves, is a level three count.
+     */
+    [[nodiscard]] constexpr std::int32_t level() const noexcept {
+        std::int32_t result = 0;
+        for (const std::int32_t weight : weights) {
+            result = std::max(result, weight < 0 ? -weight : weight);
+        }
+        return result;
+    }
+
+private:
+    Weights weights {};
+    std::int32_t scale = 1;
+};
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_STRATEGY_HPP
@@ -0,0 +1,71 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_CORE_TRUECOUNT_HPP
+#define CARD_COUNTER_CORE_TRUECOUNT_HPP
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+// own
+#include "core/cards.hpp"
+
+namespace core {
+
+/** How a true count is rounded to the whole number the player answers. */
+enum class Rounding { Floor, Truncate, Nearest };
+
+/**
+ * @brief Running count per deck left, in points.
+ * @param running    running count in 1 / @p scale points
+ * @param cards_left standard cards still to be dealt; a single card counts
+ *                   as a fraction of a deck, never as zero
+ */
+[[nodiscard]] inline double true_count(
+    const std::int32_t running, const std::int32_t scale,
+    const std::int32_t cards_left
+) noexcept {
+    const double decks = static_cast<double>(std::max(cards_left, 1))
+        / (deck_size - jokers_per_deck);
+    return running / (std::max(scale, 1) * decks);
+}
+
+/** Round a true count the way the player is asked to. */
+[[nodiscard]] inline std::int32_t
+round_true_count(const double value, const Rounding rounding) noexcept {
+    switch (rounding) {
+    case Rounding::Floor:
+        return static_cast<std::int32_t>(std::floor(value));
+    case Rounding::Truncate:
+        return static_cast<std::int32_t>(std::trunc(value));
+    case Rounding::Nearest:
+        break;
+    }
+    return static_cast<std::int32_t>(std::lround(value));
+}
+
+} // namespace core
+
+#endif // CARD_COUNTER_CORE_TRUECOUNT_HPP
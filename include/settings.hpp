@@ -32,56 +32,144 @@ class Settings final : public QObject {
     Q_OBJECT
 
 public:
+    /**
+     * What a joker asks for. Deviation asks for the play of a situation
+     * from core::deviations at the current true count.
+     */
+    enum QuizType { RunningCount = 0, TrueCount, EitherCount, Deviation };
+
+    /** Settings touched by a change, as changed() reports them. */
+    enum class Change : quint32 {
+        Indexing = 1 << 0,
+        ShowPenetration = 1 << 1,
+        StrategyHint = 1 << 2,
+        Training = 1 << 3,
+        ShowTime = 1 << 4,
+        ShowScore = 1 << 5,
+        ShowSpeed = 1 << 6,
+        InfinityMode = 1 << 7,
+        ContinuousShuffle = 1 << 8,
+        ShuffleDelay = 1 << 9,
+        BlackjackSeats = 1 << 10,
+        AdaptivePolicy = 1 << 11,
+        QuizType = 1 << 12,
+        TrueCountRounding = 1 << 13,
+        CardTheme = 1 << 14,
+        CardBorder = 1 << 15,
+    };
+    Q_DECLARE_FLAGS(Changes, Change)
+
     static Settings& instance();
 
     [[nodiscard]] bool indexing() const;
+    /** Add the share of the shoe dealt to the index label. */
+    [[nodiscard]] bool show_penetration() const;
     [[nodiscard]] bool strategy_hint() const;
     [[nodiscard]] bool training() const;
     [[nodiscard]] bool show_time() const;
     [[nodiscard]] bool show_score() const;
     [[nodiscard]] bool show_speed() const;
     [[nodiscard]] bool infinity_mode() const;
+    /** Deal from a continuous shuffling machine, see core::ContinuousShoe. */
+    [[nodiscard]] bool continuous_shuffle() const;
+    /** Cards dealt before a discard goes back into the machine. */
+    [[nodiscard]] int shuffle_delay() const;
+    /** Blackjack players per slot, 0 only deals; see core::BlackjackRound. */
+    [[nodiscard]] int blackjack_seats() const;
+    /** Weighting of slots in the adaptive card mode, see core::SlotSampler. */
+    [[nodiscard]] int adaptive_policy() const;
+    /** What a joker asks for, see QuizType. */
+    [[nodiscard]] int quiz_type() const;
+    /** Rounding of true count answers, a core::Rounding. */
+    [[nodiscard]] int true_count_rounding() const;
     [[nodiscard]] QString card_theme() const;
     // [[nodiscard]]  QColor card_background() const;
     [[nodiscard]] QColor card_border() const;
 
+    /**
+     * @brief Collect the changes of the following setters.
+     *
+     * Until the matching end_changes() the setters still save and emit
+     * their own signals, but changed() is held back and then emitted once
+     * for all of them. Calls nest.
+     */
+    void begin_changes();
+
+    void end_changes();
+
 public slots:
     void set_indexing(bool value);
+    void set_show_penetration(bool value);
     void set_strategy_hint(bool value);
     void set_training(bool value);
     void set_show_time(bool value);
     void set_show_score(bool value);
     void set_show_speed(bool value);
     void set_infinity_mode(bool value);
+    void set_continuous_shuffle(bool value);
+    void set_shuffle_delay(int value);
+    void set_blackjack_seats(int value);
+    void set_adaptive_policy(int value);
+    void set_quiz_type(int value);
+    void set_true_count_rounding(int value);
     void set_card_theme(const QString& value);
     // void set_card_background(const QColor& value);
     void set_card_border(const QColor& value);
 
 signals:
     void indexing_changed(bool value);
+    void show_penetration_changed(bool value);
     void strategy_hint_changed(bool value);
     void training_changed(bool value);
     void show_time_changed(bool value);
     void show_score_changed(bool value);
     void show_speed_changed(bool value);
     void infinity_mode_changed(bool value);
+    void continuous_shuffle_changed(bool value);
+    void shuffle_delay_changed(int value);
+    void blackjack_seats_changed(int value);
+    void adaptive_policy_changed(int value);
+    void quiz_type_changed(int value);
+    void true_count_rounding_changed(int value);
     void card_theme_changed(const QString& value);
     // void card_background_changed(const QColor& value);
     void card_border_changed(const QColor& value);
 
+    /**
+     * @brief Settings changed, once per setter call or once for all the
+     * calls between begin_changes() and end_changes().
+     */
+    void changed(Settings::Changes changes);
+
 private:
     explicit Settings(QObject* parent = nullptr);
 
+    /** Add @p change to the pending ones, emitted unless collecting. */
+    void touch(Change change);
+
     bool indexing_ = false;
+    bool show_penetration_ = false;
     bool strategy_hint_ = false;
     bool is_training_ = false;
     bool show_time_ = true;
     bool show_score_ = true;
     bool show_speed_ = true;
     bool infinity_mode_ = false;
+    bool continuous_shuffle_ = false;
+    int shuffle_delay_ = 20;
+    int blackjack_seats_ = 0;
+    int adaptive_policy_ = 3;
+    int quiz_type_ = RunningCount;
+    int true_count_rounding_ = 0;
     QString card_theme_ = "tigullio-international";
     // QColor card_background_ = Qt::white;
     QColor card_border_ = Qt::green;
+
+    /** Open begin_changes() calls. */
+    int change_depth = 0;
+    Changes pending_changes;
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(Settings::Changes)
+
 #endif // CARD_COUNTER_SETTINGS_HPP
\ No newline at end of file
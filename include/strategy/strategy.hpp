@@ -28,6 +28,10 @@
 // Qt
 #include <QString>
 #include <QVector>
+// own
+#include "core/builtins.hpp"
+#include "core/deviations.hpp"
+#include "core/strategy.hpp"
 
 /**
  * @brief Card counting strategy definition.
@@ -38,14 +42,22 @@ public:
      * @brief Construct a new strategy.
      * @param name        display name
      * @param description markdown description text
-     * @param weights     weight for ranks Ace..King
+     * @param weights     weight for ranks Ace..King, missing ones are zero
      * @param custom      whether the strategy was created by the user
+     * @param scale       fixed point scale of the weights, see core::Strategy
      */
     explicit Strategy(
         QString name, QString description, QVector<qint32> weights,
-        bool custom = false
+        bool custom = false, qint32 scale = 1
     );
 
+    /**
+     * @brief Wrap a built-in system without copying its texts.
+     * @param description untranslated markdown with static storage, turned
+     *                    into a QString only when it is shown
+     */
+    Strategy(const core::BuiltinStrategy& builtin, const char* description);
+
     /** Whether this strategy was defined by the user. */
     [[nodiscard]] bool is_custom() const noexcept;
 
@@ -55,17 +67,31 @@ public:
     /** Strategy description. */
     [[nodiscard]] QString get_description() const;
 
-    /** Weight for the given rank index (0 based). */
+    /** Weight for the given rank index (0 based), in 1 / scale points. */
     [[nodiscard]] qint32 get_weights(qint32 id) const;
 
+    /** Fixed point scale of the weights and counts. */
+    [[nodiscard]] qint32 get_scale() const noexcept;
+
+    /** Format a weight or count in units as points, e.g. "-1.5". */
+    [[nodiscard]] QString format_count(qint32 units) const;
+
     /**
      * @brief Update the current running count with a card rank.
      */
-    qint32 update_weight(qint32 current_weight, qint32 rank);
+    qint32 update_weight(qint32 current_weight, qint32 rank) const;
+
+    /** The weights as used by the game engine. */
+    [[nodiscard]] const core::Strategy& get_counting() const noexcept;
+
+    /** Shipped deviation indices of a built-in system, or nullptr. */
+    [[nodiscard]] const core::IndexTable* get_builtin_indices() const noexcept;
 
 private:
     bool custom;
-    QVector<qint32> weights;
+    core::Strategy counting;
+    const core::BuiltinStrategy* builtin = nullptr;
+    const char* builtin_description = nullptr;
     QString name;
     QString description;
 };
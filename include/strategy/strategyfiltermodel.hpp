@@ -0,0 +1,82 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_STRATEGYFILTERMODEL_HPP
+#define CARD_COUNTER_STRATEGYFILTERMODEL_HPP
+
+// Qt
+#include <QBitArray>
+#include <QHash>
+#include <QSortFilterProxyModel>
+#include <QVector>
+
+/**
+ * @brief Sorted view of the strategy names with a substring search.
+ *
+ * Every name is indexed by its case folded n-grams of up to three
+ * characters as rows arrive. A query only checks the rows listed under
+ * its rarest n-gram, so filtering does not scan the whole library.
+ */
+class StrategyFilterModel final : public QSortFilterProxyModel {
+    Q_OBJECT
+public:
+    explicit StrategyFilterModel(QObject* parent = nullptr);
+
+    void setSourceModel(QAbstractItemModel* source) override;
+
+    /** Show only names containing @p text, ignoring case. */
+    void set_query(const QString& text);
+
+    [[nodiscard]] const QString& get_query() const noexcept { return query; }
+
+protected:
+    [[nodiscard]] bool filterAcceptsRow(
+        int source_row, const QModelIndex& source_parent
+    ) const override;
+
+private:
+    static constexpr qsizetype max_gram = 3;
+
+    /** Append rows @p first to @p last, which must follow the last one. */
+    void index_rows(int first, int last);
+
+    void rebuild();
+
+    /** Recompute matches for the current query, without refiltering. */
+    void match_rows();
+
+    [[nodiscard]] QString source_name(int row) const;
+
+    [[nodiscard]] static quint64 gram_key(QStringView gram) noexcept;
+
+    /** Case folded names by source row. */
+    QVector<QString> names;
+    /** Ascending source rows containing each n-gram. */
+    QHash<quint64, QVector<int>> grams;
+    QString query;
+    QBitArray matches;
+    QList<QMetaObject::Connection> source_connections;
+};
+
+#endif // CARD_COUNTER_STRATEGYFILTERMODEL_HPP
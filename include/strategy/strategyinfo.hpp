@@ -27,15 +27,25 @@
 
 // Qt
 #include <QDialog>
+// std
+#include <atomic>
 #include <memory>
+// own
+#include "core/evaluator.hpp"
 
 class Strategy;
 
+class Cards;
+
+class Carousel;
+
 class QSvgRenderer;
 
 class QLabel;
 
-class QSpinBox;
+class QDoubleSpinBox;
+
+class QComboBox;
 
 class QPushButton;
 
@@ -43,12 +53,17 @@ class QLineEdit;
 
 class QTextEdit;
 
-class QListWidget;
+class QListView;
 
-class KConfigGroup;
+class StrategyFilterModel;
+
+class QTimer;
 
 /**
  * @brief Dialog for browsing and editing card counting strategies.
+ *
+ * The strategies themselves live in the StrategyRegistry; the dialog only
+ * keeps the template a new custom strategy is written into.
  */
 class StrategyInfo final : public QDialog {
     Q_OBJECT
@@ -58,43 +73,84 @@ public:
         Qt::WindowFlags flags = Qt::WindowFlags()
     );
 
-    /**
-     * @brief Retrieve a strategy object by its index.
-     */
-    Strategy* get_strategy_by_id(qint32 id);
+    ~StrategyInfo() override;
 
     /**
      * @brief Display the strategy details for the given name.
      */
     void show_strategy_by_name(const QString& name);
 
-    /**
-     * @brief Access to the internal list of strategies.
-     */
-    const QVector<Strategy*>& get_strategies() const;
-
-signals:
-
-    void new_strategy();
+    /** Redraw the cards with a new theme. */
+    void set_renderer(QSvgRenderer* renderer);
 
 private:
-    QVector<Strategy*> items;
+    /** Edited to create a custom strategy, not part of the registry. */
+    std::unique_ptr<Strategy> template_strategy;
     QSvgRenderer* renderer;
+    /** Registry index of the shown strategy, or -1 for the template. */
     qint32 id;
     QLabel* name;
     QLabel* description;
     QLineEdit* name_input;
     QTextEdit* description_input;
     QPushButton* save_button;
-    QListWidget* list_widget;
-    QVector<QSpinBox*> weights;
-    KConfigGroup* strategies_group;
+    QPushButton* optimise_button;
+    QListView* list_view;
+    StrategyFilterModel* filter;
+    QTimer* search_timer;
+    Carousel* carousel;
+    QVector<Cards*> cards;
+    /** Weights in points, stepping by 1 / the selected scale. */
+    QVector<QDoubleSpinBox*> weights;
+    QComboBox* fractions;
+    QLabel* evaluation;
+    QLabel* distribution;
+    QTimer* evaluation_timer;
+    /** Cancels the evaluation in flight, if any. */
+    std::shared_ptr<std::atomic<bool>> evaluation_cancel;
+    core::Weights evaluating {};
+    /** Counts show_distribution() calls, older results are dropped. */
+    quint64 distribution_request = 0;
+    /** Cancels the running optimisation, if any. */
+    std::shared_ptr<std::atomic<bool>> optimiser_cancel;
+
+    /** Weights currently shown in the spin boxes, in 1 / scale points. */
+    [[nodiscard]] core::Weights current_weights() const;
+
+    /** Fixed point scale selected for the shown weights. */
+    [[nodiscard]] qint32 current_scale() const;
+
+    /** Switch the spin boxes to a new scale, rounding their values. */
+    void set_scale(qint32 scale);
 
-    void init_strategies();
+    /**
+     * @brief Show the evaluation of the current weights.
+     *
+     * Cached results show immediately, otherwise the simulation runs on
+     * the thread pool and the label updates when it is done.
+     */
+    void evaluate_current();
 
-    void add_fake_strategy();
+    void show_evaluation(const core::Evaluation& result);
+
+    /**
+     * @brief Show exact true count odds.
+     *
+     * Computed on the thread pool, the label keeps the previous odds until
+     * those of the latest call are ready.
+     */
+    void show_distribution(const core::Weights& current, qint32 scale);
+
+    /**
+     * @brief Search for the best weights of the given level.
+     *
+     * Runs in the background behind a progress dialog; the results are
+     * saved as custom strategies.
+     */
+    void optimise(qint32 level);
 
-    void fill_list();
+    /** Show the registry strategy at @p index, or the template for -1. */
+    void show_strategy(qint32 index);
 };
 
 #endif // CARD_COUNTER_STRATEGYINFO_HPP
@@ -0,0 +1,61 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_STRATEGYLISTMODEL_HPP
+#define CARD_COUNTER_STRATEGYLISTMODEL_HPP
+
+// Qt
+#include <QAbstractListModel>
+
+class StrategyRegistry;
+
+/**
+ * @brief List model over the strategies of the StrategyRegistry.
+ *
+ * One instance is shared by every view. Rows follow the registry order and
+ * are appended in blocks or changed in place, so views keep their
+ * selection.
+ */
+class StrategyListModel final : public QAbstractListModel {
+    Q_OBJECT
+public:
+    enum Role {
+        /** Whether the strategy was created by the user. */
+        CustomRole = Qt::UserRole + 1,
+    };
+
+    explicit StrategyListModel(StrategyRegistry* registry);
+
+    [[nodiscard]] int rowCount(const QModelIndex& parent = {}) const override;
+
+    [[nodiscard]] QVariant
+    data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+private:
+    StrategyRegistry* registry;
+};
+
+#endif // CARD_COUNTER_STRATEGYLISTMODEL_HPP
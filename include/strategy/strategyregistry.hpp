@@ -0,0 +1,161 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_STRATEGYREGISTRY_HPP
+#define CARD_COUNTER_STRATEGYREGISTRY_HPP
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QVector>
+// std
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+// own
+#include "core/deviations.hpp"
+#include "core/evaluator.hpp"
+#include "core/library.hpp"
+
+class Strategy;
+
+class StrategyListModel;
+
+/**
+ * @brief Owner of all counting strategies, loaded once per process.
+ *
+ * Built-in systems come first, in the order of core::builtin_table,
+ * followed by the custom strategies saved in the ConfigStore.
+ * Pointers handed out stay valid for the lifetime of the process; saving a
+ * custom strategy under an existing name updates that object in place.
+ */
+class StrategyRegistry final : public QObject {
+    Q_OBJECT
+public:
+    static StrategyRegistry& instance();
+
+    ~StrategyRegistry() override;
+
+    [[nodiscard]] const QVector<const Strategy*>& get_strategies() const;
+
+    /** Strategy at @p index, or nullptr if there is none. */
+    [[nodiscard]] const Strategy* get_strategy(qint32 index) const;
+
+    /** Index of the strategy called @p name, or -1. */
+    [[nodiscard]] qint32 index_of(const QString& name) const;
+
+    /**
+     * @brief Save a custom strategy and add it to the list.
+     *
+     * Replaces a custom strategy of the same name. The weights are in
+     * units of 1 / @p scale points.
+     * @return the saved strategy, or nullptr if @p name belongs to a
+     *         built-in system
+     */
+    const Strategy* add_custom(
+        const QString& name, const QString& description,
+        const QVector<qint32>& weights, qint32 scale = 1
+    );
+
+    /**
+     * @brief Save many custom strategies in one batch.
+     *
+     * New strategies are appended in one block. Entries named after a
+     * built-in system are skipped.
+     * @return how many entries were saved
+     */
+    qint32 add_customs(const std::vector<core::LibraryEntry>& entries);
+
+    /**
+     * @brief Add the strategies of a CSV library file.
+     *
+     * Nothing is saved unless the whole file is valid.
+     * @return how many strategies were saved, or -1 with @p error set
+     */
+    qint32 import_library(const QString& path, QString& error);
+
+    /** Write the custom strategies to a CSV library file. */
+    bool export_library(const QString& path, QString& error) const;
+
+    /** Model over get_strategies(), shared by every view. */
+    [[nodiscard]] StrategyListModel* get_model() const noexcept {
+        return model;
+    }
+
+    /** Simulation results by weight vector, kept for the whole session. */
+    [[nodiscard]] core::EvaluationCache& get_evaluations() noexcept {
+        return evaluations;
+    }
+
+    /**
+     * @brief Deviation indices of @p strategy, in its points.
+     *
+     * Built-in systems that ship a table answer at once. For the others
+     * the indices are simulated on the thread pool the first time they are
+     * asked for, kept for the session by weights, and indices_computed()
+     * is emitted when they are ready.
+     * @return the table, or nullptr while it is being computed
+     */
+    [[nodiscard]] const core::IndexTable* get_indices(const Strategy& strategy
+    );
+
+signals:
+
+    /** Custom strategies are about to be appended at @p first..@p last. */
+    void strategies_about_to_be_added(qint32 first, qint32 last);
+
+    void strategies_added(qint32 first, qint32 last);
+
+    /** The custom strategy at @p index was saved again. */
+    void strategy_updated(qint32 index);
+
+    /**
+     * @brief Indices asked for by get_indices() are ready.
+     *
+     * Table slots listen for it to stop waiting for the indices; their
+     * next joker asks for the play.
+     */
+    void indices_computed();
+
+private:
+    explicit StrategyRegistry(QObject* parent = nullptr);
+
+    /** List @p strategy last and index its name. */
+    void append(const Strategy* strategy);
+
+    QVector<const Strategy*> items;
+    /** Index in items by name, the first one wins. */
+    QHash<QString, qint32> positions;
+    std::vector<std::unique_ptr<Strategy>> custom_items;
+    core::EvaluationCache evaluations;
+    /** Weights and scale of a strategy, the key of its indices. */
+    using IndexKey = std::pair<core::Weights, qint32>;
+    std::map<IndexKey, core::IndexTable> indices;
+    std::set<IndexKey> computing;
+    StrategyListModel* model {};
+};
+
+#endif // CARD_COUNTER_STRATEGYREGISTRY_HPP
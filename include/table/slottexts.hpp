@@ -0,0 +1,93 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_SLOTTEXTS_HPP
+#define CARD_COUNTER_SLOTTEXTS_HPP
+
+// Qt
+#include <QString>
+#include <QVector>
+
+namespace core {
+struct Hand;
+class BlackjackRound;
+class Shoe;
+}
+
+/**
+ * @brief Translated label texts that table slots show while dealing.
+ *
+ * Each text is formatted once from a cached translation template and then
+ * handed out as an implicitly shared QString, so refreshing a label with a
+ * value that was seen before does not allocate.
+ */
+class SlotTexts {
+public:
+    /**
+     * @brief The "weight: N" text of the training label.
+     * @param value running count in units of 1 / @p scale points
+     */
+    [[nodiscard]] static const QString&
+    weight(qint32 value, qint32 scale = 1);
+
+    /**
+     * @brief The "name: N" text of a side count label.
+     *
+     * Texts are kept by counter name and scale, so a strategy saved with
+     * new weights keeps its texts and a renamed one gets fresh ones.
+     */
+    [[nodiscard]] static const QString&
+    side_count(const QString& name, qint32 value, qint32 scale);
+
+    /**
+     * @brief The "N/total" texts of the index label.
+     *
+     * The returned list holds the texts for N = 0..total and shares its
+     * data with every other slot of the same shoe size.
+     */
+    [[nodiscard]] static QVector<QString> positions(qint32 total);
+
+    /**
+     * @brief The "N/total, P%" texts of the index label for @p shoe.
+     *
+     * Like positions(), with the share of the standard cards dealt once N
+     * cards are gone. The share depends on where the jokers lie, so the
+     * list is built per shoe from texts shared by all shoes of its size.
+     */
+    [[nodiscard]] static QVector<QString> penetrations(const core::Shoe& shoe);
+
+    /** Total of a blackjack hand, such as "soft 17" or "bust". */
+    [[nodiscard]] static const QString& hand(const core::Hand& hand);
+
+    /**
+     * @brief The dealer and player hands of @p round, with the winnings
+     * once it is over.
+     *
+     * Formatted anew on every call; the slot asks only when a round ends or
+     * the shoe is refilled.
+     */
+    [[nodiscard]] static QString round(const core::BlackjackRound& round);
+};
+
+#endif // CARD_COUNTER_SLOTTEXTS_HPP
@@ -27,8 +27,10 @@
 
 // Qt
 #include <KGameDifficultyLevel>
-#include <QSet>
 #include <QWidget>
+// own
+#include "core/engine.hpp"
+#include "settings.hpp"
 
 class QGridLayout;
 
@@ -39,9 +41,13 @@ class TableSlot;
 class StrategyInfo;
 
 /**
- * @brief Widget hosting all table slots and game logic.
+ * @brief Widget hosting all table slots.
+ *
+ * The game itself runs in a core::Engine; the table drives it with a
+ * timer, lays out one TableSlot per engine slot and forwards the engine
+ * events to them.
  */
-class Table final : public QWidget {
+class Table final : public QWidget, public core::EngineObserver {
     Q_OBJECT
 public:
     explicit Table(QWidget* parent = nullptr);
@@ -63,6 +69,12 @@ public Q_SLOTS:
     void set_speed(int interval_ms) const;
     void force_game_over();
 
+public:
+    void card_dealt(std::int32_t handle, std::int32_t card) override;
+    void joker_dealt(std::int32_t handle) override;
+    void shoe_finished(std::int32_t handle) override;
+    void round_finished(std::int32_t handle) override;
+
 signals:
 
     void game_paused(bool paused);
@@ -79,12 +91,8 @@ private Q_SLOTS:
 
     void on_table_slot_activated();
 
-    void on_table_slot_finished();
-
     void on_table_slot_removed();
 
-    void on_table_slot_reshuffled();
-
     void on_user_quizzed();
 
     void on_user_answered(bool correct);
@@ -93,14 +101,29 @@ private Q_SLOTS:
 
     void pick_up_cards();
 
-    void on_strategy_info_assist() const;
+    /** Show the strategy dialog, created on first use. */
+    void on_strategy_info_assist();
+
+    /** Hand settings changes to all slots in one update. */
+    void apply_settings(Settings::Changes changes);
 
 protected:
     void resizeEvent(QResizeEvent* event) override;
 
 private:
+    /** Add a slot to the engine, with a pooled widget if there is one. */
     void add_new_table_slot(bool is_active = false);
 
+    /**
+     * @brief Remove a slot from the engine and recycle its handle.
+     *
+     * The widget goes back to the pool.
+     */
+    void release_table_slot(TableSlot* table_slot);
+
+    /** Detach a slot widget from the table and keep it for reuse. */
+    void pool_table_slot(TableSlot* table_slot);
+
     /**
      * @brief Determine how many columns can fit on screen.
      *
@@ -136,18 +159,15 @@ private:
     qreal scale = -1;
     bool rotated = false;
 
-    enum class card_mode {
-        Ordered,
-        Simultaneous,
-        Random
-    } mode
-        = card_mode::Ordered;
-    qint32 order_index = 0;
-
-    QVector<int> swap_target;
-    QVector<TableSlot*> items;
-    QSet<qint32> jokers;
-    QSet<qint32> available;
+    core::Engine engine;
+    QVector<qint32> swap_target;
+    /** Slot widgets by engine handle, free handles are null. */
+    QVector<TableSlot*> views;
+    /**
+     * Released slot widgets, reset and reused by add_new_table_slot()
+     * instead of building a new one.
+     */
+    QVector<TableSlot*> pool;
 };
 
 #endif // CARD_COUNTER_TABLE_HPP
@@ -26,33 +26,48 @@
 #define CARD_COUNTER_TABLESLOT_HPP
 
 // own
+#include "core/deviations.hpp"
+#include "settings.hpp"
 #include "widgets/cards.hpp"
 
 class QSvgRenderer;
 
 class QSpinBox;
 
+class QDoubleSpinBox;
+
+class QHBoxLayout;
+
 class QVBoxLayout;
 
 class QPushButton;
 
+class QToolButton;
+
+class QLabel;
+
 class CCFrame;
 
 class CCLabel;
 
-class StrategyInfo;
-
 class Strategy;
 
 class QComboBox;
 
 class QPropertyAnimation;
 
+namespace core {
+class Engine;
+}
+
 /**
  * @brief Interactive widget displaying a deck of cards.
  *
- * Represents one slot on the table. It maintains its own deck and
- * counting strategy and communicates with the Table via signals.
+ * Represents one slot on the table. The shoe, the running counts and the
+ * activation state live in the core::Engine under the slot's handle; the
+ * widget shows them, forwards user input to the engine and communicates
+ * with the Table via signals. Besides the main strategy the player may
+ * keep a few side counts, and a joker asks for any one of them.
  */
 class TableSlot final : public Cards {
     Q_OBJECT
@@ -61,9 +76,13 @@ class TableSlot final : public Cards {
             set_highlight_opacity
     )
 public:
+    /**
+     * @param engine game state, must outlive the widget
+     * @param handle slot created in @p engine for this widget
+     */
     explicit TableSlot(
-        StrategyInfo* strategies, QSvgRenderer* renderer,
-        bool is_active = false, QWidget* parent = nullptr
+        core::Engine* engine, qint32 handle, QSvgRenderer* renderer,
+        QWidget* parent = nullptr
     );
 
     /**
@@ -72,15 +91,57 @@ public:
     [[nodiscard]] bool is_fake() const;
 
     /**
-     * @brief Draw the next card and update weights.
+     * @brief Handle of the slot in the engine.
+     *
+     * Unlike the position in the layout it survives swaps and removals of
+     * other slots.
      */
-    void pick_up_card();
+    [[nodiscard]] qint32 get_handle() const noexcept { return handle; }
 
-    void set_infinite_params(int idx, int total);
+    /**
+     * @brief Start over as a new slot for @p handle.
+     *
+     * Slots are pooled by the Table and reset instead of rebuilt; the state
+     * afterwards is that of a freshly constructed slot.
+     */
+    void reset(qint32 handle);
+
+    /**
+     * @brief Keep @p strategies as side counts, as if picked from the menu.
+     *
+     * Strategies beyond core::CounterSet::max_counters - 1 are ignored.
+     */
+    void set_side_counts(const QVector<const Strategy*>& strategies);
+
+    /** Detach from the engine and the shared strategies until reset(). */
+    void release();
+
+    /**
+     * @brief Follow a batch of settings changes.
+     *
+     * Called by the Table for all slots at once, so that one apply of the
+     * settings dialog relayouts and repaints the table once.
+     */
+    void apply_settings(Settings::Changes changes);
+
+    /**
+     * @name Engine events
+     * Called by the Table when the engine dealt to this slot.
+     */
+    ///@{
+    void on_card_dealt(qint32 card);
+    void on_joker_dealt();
+    /** The round label shows settled rounds only, not every card. */
+    void on_round_finished();
+    void on_shoe_finished();
+    ///@}
 
 protected:
     void paintEvent(QPaintEvent* event) override;
 
+    /** Explain the weight label with the count under every strategy. */
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
 signals:
 
     void table_slot_activated();
@@ -103,9 +164,7 @@ public Q_SLOTS:
 
     void on_game_paused(bool paused);
 
-    void on_can_remove(bool can_remove) const;
-
-    void on_new_strategy() const;
+    void on_can_remove(bool can_remove);
 
     void on_strategy_changed(int index);
 
@@ -115,13 +174,47 @@ public Q_SLOTS:
 
     void activate(int value);
 
+private:
+    void user_quizzing();
+
+    /** Strategy of the counter the current joker asks for. */
+    [[nodiscard]] const Strategy* quizzed_strategy() const;
+
+    /** Hand the side counts to the engine, counted from the dealt cards. */
+    void apply_side_counts();
+
+    /** List the registry strategies to pick side counts from. */
+    void fill_side_menu();
+
     /**
-     * @brief Replace the strategies object used by this slot.
+     * @name Lazy frames
+     * The answer and control frames are built when first shown, most slots
+     * of a game never show the answer frame.
      */
-    void set_strategies(StrategyInfo* info);
+    ///@{
+    CCFrame* get_answer_frame();
+    CCFrame* get_control_frame();
+    ///@}
 
-private:
-    void user_quizzing();
+    /** Load a freshly shuffled shoe for the chosen number of decks. */
+    void refill_shoe();
+
+    /** Pick the index label texts for the current shoe and settings. */
+    void fill_position_texts();
+
+    /**
+     * @name Label refresh
+     * Labels are only updated while visible; a label catches up with the
+     * current state when it is shown again.
+     */
+    ///@{
+    void refresh_index_label() const;
+    void refresh_weight_label() const;
+    void refresh_round_label() const;
+    ///@}
+
+    /** Give every side count a label, shown along with the weight label. */
+    void fit_side_labels();
 
     float get_highlight_opacity() const;
     void set_highlight_opacity(float value);
@@ -131,32 +224,67 @@ private:
     float highlight_opacity;
     QPropertyAnimation* highlight_anim;
 
-    QList<qint32> cards;
-    Strategy* strategy {};
-    StrategyInfo* strategies;
-    qint32 current_weight = 0;
-    bool fake = true;
+    core::Engine* engine;
+    qint32 handle;
+    /**
+     * Texts of the index label by cards dealt, their strings shared between
+     * slots of equal shoe size.
+     */
+    QVector<QString> position_texts;
+    const Strategy* strategy {};
+    /** Whether the current joker asks for the true count. */
+    bool asking_true_count = false;
+    /** Indices of the asked strategy if the joker asks for a play. */
+    const core::IndexTable* deviation_indices {};
+    /**
+     * Whether the current joker asks for the count only because the
+     * indices of its strategy are still being simulated. Cleared once they
+     * are ready; the joker keeps its count quiz, the next one asks for the
+     * play.
+     */
+    bool awaiting_indices = false;
+    /** Situation asked for, in core::deviations. */
+    std::size_t deviation = 0;
+    /** Registry strategies kept as side counts, in engine counter order. */
+    QVector<const Strategy*> side_counts;
 
-    CCFrame* answer_frame;
+    CCFrame* answer_frame {};
     CCFrame* settings_frame;
-    CCFrame* control_frame;
+    CCFrame* control_frame {};
+    /** Holds the frames, in the order answer, settings, control. */
+    QVBoxLayout* frame_layout;
 
     QSpinBox* deck_count;
-    QSpinBox* weight_box;
+    /** The answer in points, stepping by the strategy's fraction. */
+    QDoubleSpinBox* weight_box {};
+    /** The answer to a deviation, holding core::Play values. */
+    QComboBox* play_box {};
 
     CCLabel* message_label;
     CCLabel* index_label;
     CCLabel* weight_label;
+    /**
+     * One label per side count next to the weight label, so that a card
+     * sets cached texts instead of joining them; kept for reuse when side
+     * counts are dropped.
+     */
+    QVector<CCLabel*> side_labels;
+    /** Holds the weight label and the side count labels. */
+    QHBoxLayout* count_layout;
     CCLabel* strategy_hint_label;
+    /** Hands of the last blackjack round settled with the dealt cards. */
+    CCLabel* round_label;
 
-    QPushButton* refresh_button;
-    QPushButton* swap_button;
-    QPushButton* close_button;
+    QPushButton* refresh_button {};
+    QPushButton* swap_button {};
+    QPushButton* close_button {};
+    /** Whether the close button shows, kept until it is built. */
+    bool removable = false;
 
     QComboBox* strategy_box;
-
-    qint32 slot_idx = 0;
-    qint32 total_slots = 1;
+    QToolButton* side_button;
+    /** Names the counter or the situation asked for. */
+    QLabel* quiz_label {};
 };
 
 #endif // CARD_COUNTER_TABLESLOT_HPP
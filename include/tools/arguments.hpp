@@ -0,0 +1,65 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CARD_COUNTER_TOOLS_ARGUMENTS_HPP
+#define CARD_COUNTER_TOOLS_ARGUMENTS_HPP
+
+// std
+#include <cstddef>
+#include <cstdint>
+// own
+#include "core/strategy.hpp"
+
+/** Command line helpers shared by the headless tools. */
+namespace tools {
+
+/** Parse a whole argument as a decimal integer. */
+bool parse_integer(const char* text, std::int64_t& value);
+
+/** Parse a whole argument as a floating point number. */
+bool parse_number(const char* text, double& value);
+
+/**
+ * @brief Find a built-in strategy by index or by name.
+ *
+ * Names match ignoring case, with or without the " Count" suffix.
+ */
+bool parse_strategy(const char* text, std::size_t& index);
+
+/**
+ * @brief Parse 13 comma separated weights for Ace..King.
+ *
+ * Weights may be fractions such as 0.5; they are returned in units of
+ * 1 / @p scale points, see core::parse_points().
+ */
+bool parse_weights(
+    const char* text, core::Weights& weights, std::int32_t& scale
+);
+
+/** Print the built-in strategies with their indices to stdout. */
+void print_strategies();
+
+} // namespace tools
+
+#endif // CARD_COUNTER_TOOLS_ARGUMENTS_HPP
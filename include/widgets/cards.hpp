@@ -182,6 +182,9 @@ private:
     bool pixmap_dirty = true;
 
     void update_pixmap();
+
+    /** Uncached implementation of @ref card_name. */
+    [[nodiscard]] static QString build_card_name(qint32 id, qint32 standard);
 };
 
 #endif // CARD_COUNTER_CARDS_HPP
@@ -47,6 +47,9 @@ public:
     /** Force recalculation of item size and layout. */
     void refresh();
 
+    /** Use a new item aspect ratio, e.g. after a card theme change. */
+    void set_aspect_ratio(QSizeF aspect_ratio);
+
 protected:
     void resizeEvent(QResizeEvent* event) override;
 
@@ -0,0 +1,149 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Qt
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QTimer>
+#include <QtConcurrentRun>
+// std
+#include <utility>
+// own
+#include "configstore.hpp"
+
+ConfigStore& ConfigStore::instance() {
+    static ConfigStore inst(
+        QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation)
+        + QStringLiteral("/state.json")
+    );
+    return inst;
+}
+
+ConfigStore::ConfigStore(QString path, QObject* parent)
+    : QObject(parent)
+    , path(std::move(path))
+    , timer(new QTimer(this)) {
+    writer.setMaxThreadCount(1);
+    timer->setSingleShot(true);
+    timer->setInterval(500);
+    connect(timer, &QTimer::timeout, this, &ConfigStore::write_snapshot);
+    connect(&written, &QFutureWatcherBase::finished, this, [this] {
+        if (!written.result()) {
+            qWarning("Could not save %s.", qPrintable(this->path));
+        }
+        // changes made during the write
+        if (dirty && !timer->isActive()) {
+            write_snapshot();
+        }
+    });
+    if (auto* app = QCoreApplication::instance()) {
+        connect(
+            app, &QCoreApplication::aboutToQuit, this, &ConfigStore::flush
+        );
+    }
+
+    QFile file(this->path);
+    if (file.open(QIODevice::ReadOnly)) {
+        QJsonParseError error {};
+        const QJsonDocument document
+            = QJsonDocument::fromJson(file.readAll(), &error);
+        if (error.error != QJsonParseError::NoError) {
+            qWarning(
+                "Ignoring %s: %s", qPrintable(this->path),
+                qPrintable(error.errorString())
+            );
+        }
+        root = document.object();
+    }
+}
+
+ConfigStore::~ConfigStore() { flush(); }
+
+bool ConfigStore::contains(const QString& group) const {
+    return root.contains(group);
+}
+
+QJsonObject ConfigStore::group(const QString& name) const {
+    return root.value(name).toObject();
+}
+
+QJsonValue ConfigStore::value(const QString& group, const QString& key) const {
+    return root.value(group).toObject().value(key);
+}
+
+void ConfigStore::set_value(
+    const QString& group, const QString& key, const QJsonValue& value
+) {
+    // taken out of the root, so the insert does not copy the group
+    QJsonObject changed = root.take(group).toObject();
+    const bool same = changed.contains(key) && changed.value(key) == value;
+    changed.insert(key, value);
+    root.insert(group, changed);
+    if (!same) {
+        schedule();
+    }
+}
+
+void ConfigStore::flush() {
+    timer->stop();
+    written.waitForFinished();
+    if (dirty) {
+        dirty = false;
+        if (!write_file(path, root)) {
+            qWarning("Could not save %s.", qPrintable(path));
+        }
+    }
+}
+
+void ConfigStore::schedule() {
+    dirty = true;
+    timer->start();
+}
+
+void ConfigStore::write_snapshot() {
+    if (!dirty || written.isRunning()) {
+        return;
+    }
+    dirty = false;
+    // the copy is shared with the worker and detaches on the next change
+    written.setFuture(QtConcurrent::run(
+        &writer, &ConfigStore::write_file, path, root
+    ));
+}
+
+bool ConfigStore::write_file(const QString& path, const QJsonObject& root) {
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    // replaces the old file only once everything is on disk
+    return file.commit();
+}
@@ -0,0 +1,287 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+// own
+#include "core/batch.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CARD_COUNTER_HAVE_AVX2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define CARD_COUNTER_HAVE_NEON 1
+#endif
+
+namespace core {
+
+namespace {
+/** Cards handed to every strategy in turn, small enough to stay in L1. */
+constexpr std::size_t block_cards = 4096;
+
+std::int32_t scalar_count(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table
+) {
+    std::int32_t sum = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        sum += table[cards[i] & 0x0f];
+    }
+    return sum;
+}
+
+std::int32_t scalar_trace(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table, std::int32_t count, std::int32_t* trace
+) {
+    for (std::size_t i = 0; i < size; ++i) {
+        count += table[cards[i] & 0x0f];
+        trace[i] = count;
+    }
+    return count;
+}
+
+#ifdef CARD_COUNTER_HAVE_AVX2
+/** Deltas of eight cards, one per 32 bit lane. */
+__attribute__((target("avx2"))) inline __m256i
+avx2_deltas(const std::int32_t* cards, const __m256i table) {
+    const __m256i ids = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(cards)
+    );
+    // the rank indexes the low byte, the zero upper bytes pick entry 0
+    const __m256i ranks = _mm256_and_si256(ids, _mm256_set1_epi32(0x0f));
+    const __m256i bytes = _mm256_shuffle_epi8(table, ranks);
+    return _mm256_srai_epi32(_mm256_slli_epi32(bytes, 24), 24);
+}
+
+__attribute__((target("avx2"))) inline __m256i
+avx2_table(const std::int8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table))
+    );
+}
+
+__attribute__((target("avx2"))) std::int32_t avx2_count(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table
+) {
+    const __m256i lookup = avx2_table(table);
+    __m256i sum = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        sum = _mm256_add_epi32(sum, avx2_deltas(cards + i, lookup));
+    }
+    __m128i half = _mm_add_epi32(
+        _mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)
+    );
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4e));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xb1));
+    return _mm_cvtsi128_si32(half) + scalar_count(cards + i, size - i, table);
+}
+
+__attribute__((target("avx2"))) std::int32_t avx2_trace(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table, const std::int32_t count, std::int32_t* trace
+) {
+    const __m256i lookup = avx2_table(table);
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256i carry = _mm256_set1_epi32(count);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i x = avx2_deltas(cards + i, lookup);
+        // prefix sums inside each 128 bit lane, then carry the low lane
+        // total into the high lane
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        x = _mm256_add_epi32(
+            x,
+            _mm256_shuffle_epi32(_mm256_permute2x128_si256(x, x, 0x08), 0xff)
+        );
+        x = _mm256_add_epi32(x, carry);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(trace + i), x);
+        carry = _mm256_permutevar8x32_epi32(x, last);
+    }
+    return scalar_trace(
+        cards + i, size - i, table,
+        _mm_cvtsi128_si32(_mm256_castsi256_si128(carry)), trace + i
+    );
+}
+#endif
+
+#ifdef CARD_COUNTER_HAVE_NEON
+/** Deltas of four cards, one per 32 bit lane. */
+inline int32x4_t
+neon_deltas(const std::int32_t* cards, const int8x16_t table) {
+    const uint32x4_t ids = vandq_u32(
+        vreinterpretq_u32_s32(vld1q_s32(cards)), vdupq_n_u32(0x0f)
+    );
+    const uint16x4_t narrow = vmovn_u32(ids);
+    const uint8x8_t index = vmovn_u16(vcombine_u16(narrow, narrow));
+    const int8x8_t bytes = vqtbl1_s8(table, index);
+    return vmovl_s16(vget_low_s16(vmovl_s8(bytes)));
+}
+
+std::int32_t neon_count(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table
+) {
+    const int8x16_t lookup = vld1q_s8(table);
+    int32x4_t sum = vdupq_n_s32(0);
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        sum = vaddq_s32(sum, neon_deltas(cards + i, lookup));
+    }
+    return vaddvq_s32(sum) + scalar_count(cards + i, size - i, table);
+}
+
+std::int32_t neon_trace(
+    const std::int32_t* cards, const std::size_t size,
+    const std::int8_t* table, std::int32_t count, std::int32_t* trace
+) {
+    const int8x16_t lookup = vld1q_s8(table);
+    const int32x4_t zero = vdupq_n_s32(0);
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        int32x4_t x = neon_deltas(cards + i, lookup);
+        x = vaddq_s32(x, vextq_s32(zero, x, 3));
+        x = vaddq_s32(x, vextq_s32(zero, x, 2));
+        x = vaddq_s32(x, vdupq_n_s32(count));
+        vst1q_s32(trace + i, x);
+        count = vgetq_lane_s32(x, 3);
+    }
+    return scalar_trace(cards + i, size - i, table, count, trace + i);
+}
+#endif
+
+using CountFunction = std::int32_t (*)(
+    const std::int32_t*, std::size_t, const std::int8_t*
+);
+using TraceFunction = std::int32_t (*)(
+    const std::int32_t*, std::size_t, const std::int8_t*, std::int32_t,
+    std::int32_t*
+);
+
+CountFunction count_function(const CountKernel kernel) {
+    switch (kernel) {
+#ifdef CARD_COUNTER_HAVE_AVX2
+    case CountKernel::Avx2:
+        return avx2_count;
+#endif
+#ifdef CARD_COUNTER_HAVE_NEON
+    case CountKernel::Neon:
+        return neon_count;
+#endif
+    default:
+        return scalar_count;
+    }
+}
+
+TraceFunction trace_function(const CountKernel kernel) {
+    switch (kernel) {
+#ifdef CARD_COUNTER_HAVE_AVX2
+    case CountKernel::Avx2:
+        return avx2_trace;
+#endif
+#ifdef CARD_COUNTER_HAVE_NEON
+    case CountKernel::Neon:
+        return neon_trace;
+#endif
+    default:
+        return scalar_trace;
+    }
+}
+} // namespace
+
+CountKernel best_count_kernel() noexcept {
+#if defined(CARD_COUNTER_HAVE_AVX2)
+    static const CountKernel best = __builtin_cpu_supports("avx2")
+        ? CountKernel::Avx2
+        : CountKernel::Scalar;
+    return best;
+#elif defined(CARD_COUNTER_HAVE_NEON)
+    return CountKernel::Neon;
+#else
+    return CountKernel::Scalar;
+#endif
+}
+
+const char* kernel_name(const CountKernel kernel) noexcept {
+    switch (kernel) {
+    case CountKernel::Avx2:
+        return "avx2";
+    case CountKernel::Neon:
+        return "neon";
+    default:
+        return "scalar";
+    }
+}
+
+CountBatch::CountBatch(
+    const std::span<const Weights> strategies, const CountKernel kernel
+)
+    // a kernel this build or processor lacks falls back to scalar
+    : kernel(kernel == best_count_kernel() ? kernel : CountKernel::Scalar) {
+    tables.reserve(strategies.size());
+    for (const Weights& weights : strategies) {
+        Table table {};
+        for (std::int32_t rank = Ace; rank <= King; ++rank) {
+            table[static_cast<std::size_t>(rank)] = static_cast<std::int8_t>(
+                weights[static_cast<std::size_t>(rank - Ace)]
+            );
+        }
+        tables.push_back(table);
+    }
+}
+
+void CountBatch::count(
+    const std::span<const std::int32_t> cards,
+    const std::span<std::int32_t> counts
+) const {
+    const CountFunction function = count_function(kernel);
+    for (std::size_t begin = 0; begin < cards.size(); begin += block_cards) {
+        const std::size_t size = std::min(block_cards, cards.size() - begin);
+        for (std::size_t s = 0; s < tables.size(); ++s) {
+            counts[s] += function(cards.data() + begin, size, tables[s].data());
+        }
+    }
+}
+
+void CountBatch::trace(
+    const std::span<const std::int32_t> cards,
+    const std::span<std::int32_t> counts, const std::span<std::int32_t> traces
+) const {
+    const TraceFunction function = trace_function(kernel);
+    for (std::size_t begin = 0; begin < cards.size(); begin += block_cards) {
+        const std::size_t size = std::min(block_cards, cards.size() - begin);
+        for (std::size_t s = 0; s < tables.size(); ++s) {
+            counts[s] = function(
+                cards.data() + begin, size, tables[s].data(), counts[s],
+                traces.data() + s * cards.size() + begin
+            );
+        }
+    }
+}
+
+} // namespace core
@@ -0,0 +1,362 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+// own
+#include "core/blackjack.hpp"
+#include "core/cards.hpp"
+
+namespace core {
+
+namespace {
+constexpr std::int32_t value_count = 11;
+constexpr std::int32_t up_count = 10;
+
+constexpr std::array<std::uint8_t, rank_count + 1> values {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10
+};
+
+constexpr std::uint8_t next_state(
+    const std::int32_t state, const std::int32_t value
+) {
+    if (state == hand_bust) {
+        return hand_bust;
+    }
+    const std::int32_t total = (state & (hand_soft - 1)) + value;
+    if (state & hand_soft) {
+        // the ace falls back to 1 instead of busting
+        return static_cast<std::uint8_t>(
+            total > 21 ? total - 10 : total | hand_soft
+        );
+    }
+    if (value == 1 && total + 10 <= 21) {
+        return static_cast<std::uint8_t>((total + 10) | hand_soft);
+    }
+    return static_cast<std::uint8_t>(total > 21 ? hand_bust : total);
+}
+
+using Transitions
+    = std::array<std::array<std::uint8_t, value_count>, hand_states>;
+
+constexpr Transitions transitions = [] {
+    Transitions table {};
+    for (std::int32_t state = 0; state < hand_states; ++state) {
+        for (std::int32_t value = 0; value < value_count; ++value) {
+            table[static_cast<std::size_t>(state)]
+                 [static_cast<std::size_t>(value)]
+                = next_state(state, value);
+        }
+    }
+    return table;
+}();
+
+constexpr std::uint8_t
+step(const std::uint8_t state, const std::int32_t value) {
+    return transitions[state][static_cast<std::size_t>(value)];
+}
+
+/** Chart entries; doubling falls back to a hit or a stand after two cards. */
+enum class move : std::uint8_t { Hit, Stand, Double, DoubleOrStand };
+
+constexpr move chart(const std::int32_t state, const std::int32_t up) {
+    const std::int32_t total = state & (hand_soft - 1);
+    const auto against = [up](const std::int32_t low, const std::int32_t high) {
+        return low <= up && up <= high;
+    };
+    if (state & hand_soft) {
+        if (total >= 19) {
+            return move::Stand;
+        }
+        if (total == 18) {
+            if (against(3, 6)) {
+                return move::DoubleOrStand;
+            }
+            return against(2, 8) ? move::Stand : move::Hit;
+        }
+        if (total == 17) {
+            return against(3, 6) ? move::Double : move::Hit;
+        }
+        if (total >= 15) {
+            return against(4, 6) ? move::Double : move::Hit;
+        }
+        return total >= 13 && against(5, 6) ? move::Double : move::Hit;
+    }
+    if (total >= 17) {
+        return move::Stand;
+    }
+    if (total >= 13) {
+        return against(2, 6) ? move::Stand : move::Hit;
+    }
+    if (total == 12) {
+        return against(4, 6) ? move::Stand : move::Hit;
+    }
+    if (total == 11) {
+        return against(2, 10) ? move::Double : move::Hit;
+    }
+    if (total == 10) {
+        return against(2, 9) ? move::Double : move::Hit;
+    }
+    return total == 9 && against(3, 6) ? move::Double : move::Hit;
+}
+
+using Chart = std::array<std::array<Action, up_count>, hand_states>;
+
+/** Basic strategy by hand state and up card, @p two_cards may double. */
+constexpr Chart make_chart(const bool two_cards) {
+    Chart table {};
+    for (std::int32_t state = 0; state < hand_states; ++state) {
+        for (std::int32_t up = 1; up <= up_count; ++up) {
+            Action action = Action::Hit;
+            switch (chart(state, up)) {
+            case move::Hit:
+                break;
+            case move::Stand:
+                action = Action::Stand;
+                break;
+            case move::Double:
+                action = two_cards ? Action::Double : Action::Hit;
+                break;
+            case move::DoubleOrStand:
+                action = two_cards ? Action::Double : Action::Stand;
+                break;
+            }
+            table[static_cast<std::size_t>(state)]
+                 [static_cast<std::size_t>(up - 1)]
+                = action;
+        }
+    }
+    return table;
+}
+
+constexpr Chart two_card_chart = make_chart(true);
+constexpr Chart later_chart = make_chart(false);
+
+/** Bit up - 1 set for every up card from @p low to @p high. */
+constexpr std::uint16_t ups(const std::int32_t low, const std::int32_t high) {
+    const auto below = [](const std::int32_t up) { return (1U << up) - 1; };
+    return static_cast<std::uint16_t>(below(high) & ~below(low - 1));
+}
+
+/** Up cards to split against, by the value of the pair. */
+constexpr std::array<std::uint16_t, value_count> splits {
+    0,
+    ups(1, 10), // aces
+    ups(2, 7),
+    ups(2, 7),
+    ups(5, 6),
+    0,
+    ups(2, 6),
+    ups(2, 7),
+    ups(1, 10),
+    static_cast<std::uint16_t>(ups(2, 6) | ups(8, 9)),
+    0,
+};
+
+void deal_to(Hand& hand, const std::int32_t rank) {
+    const std::uint8_t value = values[static_cast<std::size_t>(rank)];
+    if (hand.cards == 0) {
+        hand.first = value;
+    } else if (hand.cards == 1) {
+        hand.pair = value == hand.first;
+    }
+    hand.state = step(hand.state, value);
+    ++hand.cards;
+}
+} // namespace
+
+std::int32_t card_value(const std::int32_t rank) noexcept {
+    return values[static_cast<std::size_t>(rank)];
+}
+
+std::uint8_t
+add_card(const std::uint8_t state, const std::int32_t rank) noexcept {
+    return step(state, values[static_cast<std::size_t>(rank)]);
+}
+
+Action basic_strategy(
+    const Hand& hand, const std::int32_t up, const bool can_split
+) noexcept {
+    const auto column = static_cast<std::size_t>(up - 1);
+    if (can_split && hand.pair && hand.cards == 2) {
+        const std::uint32_t columns
+            = splits[static_cast<std::size_t>(hand.first)];
+        if (columns >> column & 1U) {
+            return Action::Split;
+        }
+    }
+    const Chart& table = hand.cards == 2 ? two_card_chart : later_chart;
+    return table[hand.state][column];
+}
+
+void BlackjackRound::set_seats(const std::int32_t value) noexcept {
+    seats = std::clamp(value, 0, max_seats);
+    reset();
+}
+
+void BlackjackRound::reset() noexcept {
+    hand_count = seats;
+    for (std::int32_t seat = 0; seat < seats; ++seat) {
+        Hand& hand = hands[static_cast<std::size_t>(seat)];
+        hand = Hand();
+        hand.seat = static_cast<std::uint8_t>(seat);
+    }
+    seat_hands.fill(1);
+    dealer = Hand();
+    current = 0;
+    net = 0;
+    current_phase = phase::Deal;
+}
+
+bool BlackjackRound::add(const std::int32_t rank) noexcept {
+    if (seats == 0) {
+        return false;
+    }
+    if (current_phase == phase::Over) {
+        reset();
+    }
+    switch (current_phase) {
+    case phase::Deal: {
+        // a card to every seat and the dealer, twice
+        const std::int32_t seat = current++ % (seats + 1);
+        deal_to(
+            seat == seats ? dealer : hands[static_cast<std::size_t>(seat)],
+            rank
+        );
+        if (current < 2 * (seats + 1)) {
+            break;
+        }
+        current = 0;
+        if (dealer.is_natural()) {
+            settle();
+            break;
+        }
+        for (std::int32_t i = 0; i < hand_count; ++i) {
+            Hand& hand = hands[static_cast<std::size_t>(i)];
+            hand.done = hand.is_natural();
+        }
+        current_phase = phase::Play;
+        play_on();
+        break;
+    }
+    case phase::Play: {
+        Hand& hand = hands[static_cast<std::size_t>(current)];
+        deal_to(hand, rank);
+        // split aces take a single card
+        hand.done = hand.doubled || hand_total(hand.state) >= 21
+            || (hand.split && hand.first == 1);
+        play_on();
+        break;
+    }
+    case phase::Dealer:
+        deal_to(dealer, rank);
+        dealer_turn();
+        break;
+    case phase::Over:
+        break;
+    }
+    return is_over();
+}
+
+void BlackjackRound::play_on() noexcept {
+    while (current < hand_count) {
+        Hand& hand = hands[static_cast<std::size_t>(current)];
+        if (hand.cards < 2) {
+            // a split hand takes its second card before it is played
+            return;
+        }
+        if (hand.done) {
+            ++current;
+            continue;
+        }
+        const bool can_split = seat_hands[hand.seat] < max_hands_per_seat;
+        switch (basic_strategy(hand, dealer.first, can_split)) {
+        case Action::Hit:
+            return;
+        case Action::Stand:
+            hand.done = true;
+            ++current;
+            break;
+        case Action::Double:
+            hand.doubled = true;
+            return;
+        case Action::Split: {
+            Hand half;
+            half.state = step(0, hand.first);
+            half.cards = 1;
+            half.first = hand.first;
+            half.seat = hand.seat;
+            half.split = true;
+            const auto at = hands.begin() + current;
+            std::copy_backward(
+                at + 1, hands.begin() + hand_count,
+                hands.begin() + hand_count + 1
+            );
+            at[0] = half;
+            at[1] = half;
+            ++hand_count;
+            ++seat_hands[half.seat];
+            return;
+        }
+        }
+    }
+    current_phase = phase::Dealer;
+    dealer_turn();
+}
+
+void BlackjackRound::dealer_turn() noexcept {
+    // the dealer only draws while some hand is left to beat
+    const bool contested = std::any_of(
+        hands.begin(), hands.begin() + hand_count, [](const Hand& hand) {
+            return hand.state != hand_bust && !hand.is_natural();
+        }
+    );
+    if (!contested || hand_total(dealer.state) >= 17) {
+        settle();
+    }
+}
+
+void BlackjackRound::settle() noexcept {
+    const std::int32_t dealer_total
+        = dealer.state == hand_bust ? 0 : hand_total(dealer.state);
+    net = 0;
+    for (std::int32_t i = 0; i < hand_count; ++i) {
+        const Hand& hand = hands[static_cast<std::size_t>(i)];
+        if (hand.is_natural()) {
+            net += dealer.is_natural() ? 0 : 3;
+            continue;
+        }
+        const std::int32_t stake = hand.doubled ? 4 : 2;
+        const std::int32_t total = hand_total(hand.state);
+        if (dealer.is_natural() || hand.state == hand_bust
+            || total < dealer_total) {
+            net -= stake;
+        } else if (total > dealer_total) {
+            net += stake;
+        }
+    }
+    current_phase = phase::Over;
+}
+
+} // namespace core
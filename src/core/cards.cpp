@@ -0,0 +1,49 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// own
+#include "core/cards.hpp"
+
+namespace core {
+
+std::vector<std::int32_t> generate_deck(const std::int32_t deck_count) {
+    std::vector<std::int32_t> deck;
+    if (deck_count <= 0) {
+        return deck;
+    }
+    deck.reserve(static_cast<std::size_t>(deck_count * deck_size));
+    for (std::int32_t i = 0; i < deck_count; ++i) {
+        for (std::int32_t rank = Ace; rank <= King; ++rank) {
+            for (std::int32_t suit = Clubs; suit <= Spades; ++suit) {
+                deck.push_back(make_card(suit, rank));
+            }
+        }
+        for (std::int32_t colour = Black; colour <= Red; ++colour) {
+            deck.push_back(make_card(colour, Joker));
+        }
+    }
+    return deck;
+}
+
+} // namespace core
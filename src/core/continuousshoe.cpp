@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <utility>
+// own
+#include "core/cards.hpp"
+#include "core/continuousshoe.hpp"
+#include "core/random.hpp"
+
+namespace core {
+
+namespace {
+/** Ranks per suit or colour, the joker included. */
+constexpr std::int32_t slots_per_suit = rank_count + 1;
+constexpr std::int32_t slot_count = 4 * slots_per_suit;
+
+std::int32_t slot_of(const std::int32_t card) {
+    return suit_of(card) * slots_per_suit + rank_of(card);
+}
+
+std::int32_t card_of(const std::int32_t slot) {
+    return make_card(slot / slots_per_suit, slot % slots_per_suit);
+}
+} // namespace
+
+void ContinuousShoe::fill(
+    const std::int32_t deck_count, const std::int32_t delay
+) {
+    std::vector<double> copies(static_cast<std::size_t>(slot_count), 0.0);
+    for (std::int32_t suit = Clubs; suit <= Spades; ++suit) {
+        for (std::int32_t rank = Ace; rank <= King; ++rank) {
+            copies[static_cast<std::size_t>(slot_of(make_card(suit, rank)))]
+                = deck_count;
+        }
+    }
+    for (const std::int32_t colour : { Black, Red }) {
+        copies[static_cast<std::size_t>(slot_of(make_card(colour, Joker)))]
+            = deck_count * jokers_per_deck / 2;
+    }
+    machine.assign(std::move(copies));
+    machine_cards = std::max(deck_count, 0) * deck_size;
+    this->delay = std::clamp(delay, 0, std::max(machine_cards - 1, 0));
+    tray.assign(static_cast<std::size_t>(this->delay) + 1, 0);
+    tray_head = 0;
+    tray_count = 0;
+}
+
+void ContinuousShoe::clear() noexcept {
+    machine.resize(0);
+    tray.clear();
+    tray_head = 0;
+    tray_count = 0;
+    machine_cards = 0;
+}
+
+std::int32_t ContinuousShoe::draw(Random& rng) {
+    const std::int32_t slot = machine.find(rng.bounded(machine_cards));
+    machine.set(slot, machine.weight(slot) - 1.0);
+    --machine_cards;
+    const std::int32_t card = card_of(slot);
+
+    // the tray holds delay + 1 cards at most, wrapping once is enough
+    std::size_t tail = tray_head + static_cast<std::size_t>(tray_count);
+    if (tail >= tray.size()) {
+        tail -= tray.size();
+    }
+    tray[tail] = card;
+    if (++tray_count > delay) {
+        const std::int32_t back = slot_of(tray[tray_head]);
+        machine.set(back, machine.weight(back) + 1.0);
+        ++machine_cards;
+        if (++tray_head == tray.size()) {
+            tray_head = 0;
+        }
+        --tray_count;
+    }
+    return card;
+}
+
+} // namespace core
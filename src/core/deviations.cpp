@@ -0,0 +1,347 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+// own
+#include "core/blackjack.hpp"
+#include "core/deviations.hpp"
+#include "core/random.hpp"
+#include "core/truecount.hpp"
+
+namespace core {
+
+namespace {
+/** Shoes dealt from one seed, the unit of work handed to the workers. */
+constexpr std::int64_t block_size = 64;
+
+/** Samples beyond this true count say little about the crossing. */
+constexpr double true_count_range = 12.0;
+
+/** Cards a situation leaves in the shoe for the hole card and the plays. */
+constexpr std::int32_t play_reserve = 20;
+
+/** Running sums of a least squares line through (true count, gain). */
+struct Fit {
+    void add(const double x, const double y) {
+        n += 1.0;
+        sx += x;
+        sxx += x * x;
+        sy += y;
+        sxy += x * y;
+    }
+
+    void merge(const Fit& other) {
+        n += other.n;
+        sx += other.sx;
+        sxx += other.sxx;
+        sy += other.sy;
+        sxy += other.sxy;
+    }
+
+    /** Where the line crosses zero, rounded and clamped to index_limit. */
+    [[nodiscard]] std::int8_t root() const {
+        const double var_x = n * sxx - sx * sx;
+        const double slope = var_x > 0.0 ? (n * sxy - sx * sy) / var_x : 0.0;
+        // a gain that does not grow with the count never pays to take
+        if (slope <= 0.0) {
+            return index_limit;
+        }
+        const double intercept = (sy - slope * sx) / n;
+        const double limit = index_limit;
+        return static_cast<std::int8_t>(
+            std::lround(std::clamp(-intercept / slope, -limit, limit))
+        );
+    }
+
+    double n = 0.0;
+    double sx = 0.0;
+    double sxx = 0.0;
+    double sy = 0.0;
+    double sxy = 0.0;
+};
+
+/**
+ * @brief The shoe after the cards of the situation, as ranks.
+ *
+ * A hand that takes more than the play_reserve cards left runs on from
+ * the front of the shoe instead of past its end.
+ */
+class Cards {
+public:
+    Cards(const std::vector<std::int8_t>& shoe, const std::size_t position)
+        : shoe(&shoe)
+        , position(position) { }
+
+    std::int32_t draw() {
+        const std::int8_t card = (*shoe)[position];
+        position = position + 1 == shoe->size() ? 0 : position + 1;
+        return card;
+    }
+
+private:
+    const std::vector<std::int8_t>* shoe;
+    std::size_t position;
+};
+
+/** Rank that stands for a card value, a ten for all the pictures. */
+std::int32_t rank_of_value(const std::int32_t value) { return value; }
+
+/** Result of a finished hand against the dealer's, in bets. */
+double settle(const std::uint8_t player, const std::uint8_t dealer) {
+    if (player == hand_bust) {
+        return -1.0;
+    }
+    if (dealer == hand_bust) {
+        return 1.0;
+    }
+    const std::int32_t difference = hand_total(player) - hand_total(dealer);
+    return difference > 0 ? 1.0 : difference < 0 ? -1.0 : 0.0;
+}
+
+std::uint8_t dealer_play(std::uint8_t dealer, Cards& cards) {
+    while (hand_total(dealer) < 17) {
+        dealer = add_card(dealer, cards.draw());
+    }
+    return dealer;
+}
+
+/** Hit by basic strategy until it says stand; the hand may not double. */
+void finish(Hand& hand, const std::int32_t up, Cards& cards) {
+    while (hand.state != hand_bust
+           && basic_strategy(hand, up, false) == Action::Hit) {
+        hand.state = add_card(hand.state, cards.draw());
+        ++hand.cards;
+    }
+}
+
+/** Stake of a hand that took its second card, played by basic strategy. */
+double play_two(Hand& hand, const std::int32_t up, Cards& cards) {
+    // split aces take no more cards
+    if (hand.first == 1) {
+        return 1.0;
+    }
+    if (basic_strategy(hand, up, false) == Action::Double) {
+        hand.state = add_card(hand.state, cards.draw());
+        return 2.0;
+    }
+    finish(hand, up, cards);
+    return 1.0;
+}
+
+/** Result of @p play in bets, the hole card drawn already. */
+double play_out(
+    const Deviation& deviation, const Play play, const std::uint8_t dealer,
+    Cards cards
+) {
+    const std::int32_t up = deviation.up;
+    Hand hand;
+    hand.state = add_card(
+        add_card(0, rank_of_value(deviation.first)),
+        rank_of_value(deviation.second)
+    );
+    hand.cards = 2;
+    hand.first = deviation.first;
+    double stake = 1.0;
+    switch (play) {
+    case Play::Stand:
+        break;
+    case Play::Hit:
+        hand.state = add_card(hand.state, cards.draw());
+        ++hand.cards;
+        finish(hand, up, cards);
+        break;
+    case Play::Double:
+        hand.state = add_card(hand.state, cards.draw());
+        stake = 2.0;
+        break;
+    case Play::Split: {
+        // no resplits, they hardly move an index
+        std::array<Hand, 2> halves;
+        std::array<double, 2> stakes {};
+        for (std::size_t i = 0; i < halves.size(); ++i) {
+            halves[i].first = deviation.first;
+            halves[i].state = add_card(
+                add_card(0, rank_of_value(deviation.first)), cards.draw()
+            );
+            halves[i].cards = 2;
+            halves[i].split = true;
+            stakes[i] = play_two(halves[i], up, cards);
+        }
+        const std::uint8_t dealt = dealer_play(dealer, cards);
+        return stakes[0] * settle(halves[0].state, dealt)
+            + stakes[1] * settle(halves[1].state, dealt);
+    }
+    case Play::Surrender:
+        return -0.5;
+    case Play::Insure:
+    case Play::NoInsurance:
+        return 0.0;
+    }
+    return stake * settle(hand.state, dealer_play(dealer, cards));
+}
+
+void deal_block(
+    const Weights& weights, const std::int32_t scale,
+    const IndexParameters& parameters, const std::int64_t block,
+    std::vector<std::int8_t>& shoe, std::array<Fit, deviation_count>& fits
+) {
+    const std::int64_t shoes = std::min(
+        block_size, parameters.shoes - block * block_size
+    );
+    for (std::size_t d = 0; d < deviation_count; ++d) {
+        const Deviation& deviation = deviations[d];
+        // the cards on the table are seen, and out of the shoe
+        const std::array<std::int32_t, 3> seen { deviation.first,
+                                                 deviation.second,
+                                                 deviation.up };
+        shoe.clear();
+        for (std::int32_t i = 0; i < 4 * parameters.deck_count; ++i) {
+            for (std::int32_t rank = Ace; rank <= King; ++rank) {
+                shoe.push_back(static_cast<std::int8_t>(rank));
+            }
+        }
+        std::int32_t seen_count = 0;
+        for (const std::int32_t value : seen) {
+            if (value == 0) {
+                continue;
+            }
+            const auto found = std::find(
+                shoe.begin(), shoe.end(), rank_of_value(value)
+            );
+            seen_count += weights[static_cast<std::size_t>(*found - Ace)];
+            shoe.erase(found);
+        }
+        const auto size = static_cast<std::int32_t>(shoe.size());
+        // a small shoe dealt deep still leaves room for the plays
+        const std::int32_t cut = std::min(
+            static_cast<std::int32_t>(parameters.penetration * size),
+            size - play_reserve
+        );
+        const std::uint8_t up_state = add_card(0, rank_of_value(deviation.up));
+
+        Random rng(
+            parameters.seed
+            ^ (static_cast<std::uint64_t>(block) * 0x9e3779b97f4a7c15ULL)
+            ^ (static_cast<std::uint64_t>(d) << 56)
+        );
+        for (std::int64_t s = 0; s < shoes; ++s) {
+            for (std::int32_t i = size - 1; i > 0; --i) {
+                std::swap(
+                    shoe[static_cast<std::size_t>(i)],
+                    shoe[static_cast<std::size_t>(rng.bounded(i + 1))]
+                );
+            }
+            std::int32_t running = seen_count;
+            for (std::int32_t i = 0; i < cut; ++i) {
+                running += weights[static_cast<std::size_t>(
+                    shoe[static_cast<std::size_t>(i)] - Ace
+                )];
+                if ((i + 1) % parameters.sample_interval) {
+                    continue;
+                }
+                const double true_count = core::true_count(
+                    running, scale, size - i - 1
+                );
+                if (std::abs(true_count) > true_count_range) {
+                    continue;
+                }
+                Cards cards(shoe, static_cast<std::size_t>(i + 1));
+                const std::int32_t hole = cards.draw();
+                if (deviation.is_insurance()) {
+                    // half a bet that pays 2:1 against a ten in the hole
+                    fits[d].add(
+                        true_count, card_value(hole) == 10 ? 1.0 : -0.5
+                    );
+                    continue;
+                }
+                const std::uint8_t dealer = add_card(up_state, hole);
+                // the dealer peeked, a blackjack settles before any play
+                if (hand_total(dealer) == 21) {
+                    continue;
+                }
+                fits[d].add(
+                    true_count,
+                    play_out(deviation, deviation.above, dealer, cards)
+                        - play_out(deviation, deviation.below, dealer, cards)
+                );
+            }
+        }
+    }
+}
+} // namespace
+
+std::optional<IndexTable> compute_indices(
+    const Weights& weights, const std::int32_t scale,
+    const IndexParameters& parameters, const std::atomic<bool>* cancel
+) {
+    const std::int64_t blocks
+        = (parameters.shoes + block_size - 1) / block_size;
+    const std::int32_t threads = std::clamp<std::int32_t>(
+        parameters.threads, 1,
+        static_cast<std::int32_t>(std::min<std::int64_t>(blocks, 1024))
+    );
+
+    std::vector<std::array<Fit, deviation_count>> results(
+        static_cast<std::size_t>(blocks)
+    );
+    std::vector<std::vector<std::int8_t>> shoes(
+        static_cast<std::size_t>(threads)
+    );
+    const bool complete = parallel_for(
+        blocks, 1, threads,
+        [&](const std::int32_t worker, const std::int64_t begin,
+            const std::int64_t end) {
+            for (std::int64_t block = begin; block < end; ++block) {
+                deal_block(
+                    weights, scale, parameters, block,
+                    shoes[static_cast<std::size_t>(worker)],
+                    results[static_cast<std::size_t>(block)]
+                );
+            }
+        },
+        cancel
+    );
+    if (!complete) {
+        return std::nullopt;
+    }
+
+    // merging in block order keeps the sums independent of the scheduling
+    std::array<Fit, deviation_count> total {};
+    for (const auto& fits : results) {
+        for (std::size_t d = 0; d < deviation_count; ++d) {
+            total[d].merge(fits[d]);
+        }
+    }
+    IndexTable indices {};
+    for (std::size_t d = 0; d < deviation_count; ++d) {
+        indices[d] = total[d].root();
+    }
+    return indices;
+}
+
+} // namespace core
@@ -0,0 +1,248 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+// own
+#include "core/distribution.hpp"
+
+namespace core {
+
+namespace {
+/** Weight of a card group and the number of its cards in the shoe. */
+struct Group {
+    std::int32_t weight;
+    std::int32_t size;
+};
+
+std::vector<Group> groups(Weights weights, const std::int32_t deck_count) {
+    std::sort(weights.begin(), weights.end());
+    std::vector<Group> result;
+    for (const std::int32_t weight : weights) {
+        if (result.empty() || result.back().weight != weight) {
+            result.push_back({ weight, 0 });
+        }
+        result.back().size += 4 * deck_count;
+    }
+    return result;
+}
+
+/** C(n, 0..n), exact up to rounding. */
+std::vector<double> binomials(const std::int32_t n) {
+    std::vector<double> row(static_cast<std::size_t>(n) + 1, 1.0);
+    for (std::int32_t k = 1; k < n; ++k) {
+        row[static_cast<std::size_t>(k)]
+            = row[static_cast<std::size_t>(k - 1)] * (n - k + 1) / k;
+    }
+    return row;
+}
+
+/** to[i + shift] += factor * from[i], for the overlap of both rows. */
+void shifted_axpy(
+    double* __restrict to, const double* __restrict from,
+    const std::int32_t width, const std::int32_t shift, const double factor
+) {
+    const std::int32_t begin = std::max(0, -shift);
+    const std::int32_t end = std::min(width, width - shift);
+    for (std::int32_t i = begin; i < end; ++i) {
+        to[i + shift] += factor * from[i];
+    }
+}
+} // namespace
+
+double Distribution::at(const std::int32_t value) const noexcept {
+    const std::int64_t index = std::int64_t(value) - offset;
+    if (index < 0 || index >= std::int64_t(probabilities.size())) {
+        return 0.0;
+    }
+    return probabilities[static_cast<std::size_t>(index)];
+}
+
+double Distribution::at_least(const std::int32_t value) const noexcept {
+    const auto first = static_cast<std::size_t>(
+        std::clamp<std::int64_t>(
+            std::int64_t(value) - offset, 0,
+            std::int64_t(probabilities.size())
+        )
+    );
+    return std::accumulate(
+        probabilities.begin() + static_cast<std::ptrdiff_t>(first),
+        probabilities.end(), 0.0
+    );
+}
+
+double Distribution::mean() const noexcept {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < probabilities.size(); ++i) {
+        sum += probabilities[i] * (offset + static_cast<double>(i));
+    }
+    return sum;
+}
+
+double Distribution::variance() const noexcept {
+    const double average = mean();
+    double sum = 0.0;
+    for (std::size_t i = 0; i < probabilities.size(); ++i) {
+        const double delta = offset + static_cast<double>(i) - average;
+        sum += probabilities[i] * delta * delta;
+    }
+    return sum;
+}
+
+CountDistribution::CountDistribution(
+    const Weights& weights, const std::int32_t deck_count
+) {
+    const std::vector<Group> shoe
+        = groups(weights, std::clamp(deck_count, 1, max_decks));
+    std::int32_t max_count = 0;
+    for (const Group& group : shoe) {
+        cards += group.size;
+        (group.weight < 0 ? min_count : max_count) += group.weight * group.size;
+    }
+    width = max_count - min_count + 1;
+    table.assign(
+        static_cast<std::size_t>(cards + 1) * static_cast<std::size_t>(width),
+        0.0
+    );
+    const auto row = [this](const std::int32_t dealt) {
+        return table.data() + static_cast<std::ptrdiff_t>(dealt) * width;
+    };
+    row(0)[-min_count] = 1.0;
+
+    // multiply in one group at a time; rows are updated from the last one
+    // down, so row(j - k) still holds the product without this group
+    std::int32_t seen = 0;
+    for (const Group& group : shoe) {
+        const std::vector<double> choose = binomials(group.size);
+        seen += group.size;
+        for (std::int32_t j = seen; j > 0; --j) {
+            const std::int32_t last = std::min(group.size, j);
+            for (std::int32_t k = 1; k <= last; ++k) {
+                shifted_axpy(
+                    row(j), row(j - k), width, group.weight * k,
+                    choose[static_cast<std::size_t>(k)]
+                );
+            }
+        }
+    }
+}
+
+std::shared_ptr<const CountDistribution>
+CountDistribution::get(const Weights& weights, const std::int32_t deck_count) {
+    using Key = std::pair<Weights, std::int32_t>;
+    using Entry = std::pair<Key, std::shared_ptr<const CountDistribution>>;
+    static std::mutex mutex;
+    // least recently used first; a table of fine weights takes megabytes,
+    // and every edit of a custom strategy asks for a new one
+    static std::vector<Entry> cache;
+    Key key { weights, std::clamp(deck_count, 1, max_decks) };
+    std::sort(key.first.begin(), key.first.end());
+    // the lock is held while a table is built, so concurrent callers
+    // asking for the same table wait for it instead of building it twice
+    const std::lock_guard lock(mutex);
+    const auto found = std::find_if(
+        cache.begin(), cache.end(),
+        [&key](const Entry& entry) { return entry.first == key; }
+    );
+    if (found != cache.end()) {
+        std::rotate(found, found + 1, cache.end());
+        return cache.back().second;
+    }
+    if (cache.size() == cache_size) {
+        cache.erase(cache.begin());
+    }
+    cache.emplace_back(
+        key, std::make_shared<const CountDistribution>(key.first, key.second)
+    );
+    return cache.back().second;
+}
+
+Distribution CountDistribution::running_count(std::int32_t dealt) const {
+    dealt = std::clamp(dealt, 0, cards);
+    const double* first
+        = table.data() + static_cast<std::ptrdiff_t>(dealt) * width;
+    const double* last = first + width;
+    // trim the counts that cannot happen after this many cards
+    while (!(*first > 0.0)) {
+        ++first;
+    }
+    while (!(*(last - 1) > 0.0)) {
+        --last;
+    }
+    // the row sums to C(cards, dealt); dividing by the sum is more
+    // accurate than dividing by the binomial
+    const double total = std::accumulate(first, last, 0.0);
+    Distribution result;
+    result.offset = min_count
+        + static_cast<std::int32_t>(first - table.data())
+        - dealt * width;
+    result.probabilities.reserve(static_cast<std::size_t>(last - first));
+    for (const double* p = first; p != last; ++p) {
+        result.probabilities.push_back(*p / total);
+    }
+    return result;
+}
+
+Distribution CountDistribution::true_count(
+    const std::int32_t dealt, const std::int32_t scale
+) const {
+    const Distribution running = running_count(dealt);
+    // a single card left counts as a fraction of a deck, not as zero
+    const std::int32_t remaining
+        = std::max(cards - std::clamp(dealt, 0, cards), 1);
+    const double decks = static_cast<double>(remaining) * std::max(scale, 1)
+        / (deck_size - jokers_per_deck);
+    const auto bucket = [decks](const std::int32_t count) {
+        return static_cast<std::int32_t>(std::floor(count / decks));
+    };
+    const auto size = static_cast<std::int32_t>(running.probabilities.size());
+    Distribution result;
+    result.offset = bucket(running.offset);
+    result.probabilities.assign(
+        static_cast<std::size_t>(
+            bucket(running.offset + size - 1) - result.offset + 1
+        ),
+        0.0
+    );
+    for (std::int32_t i = 0; i < size; ++i) {
+        const std::int32_t count = running.offset + i;
+        const auto index
+            = static_cast<std::size_t>(bucket(count) - result.offset);
+        result.probabilities[index]
+            += running.probabilities[static_cast<std::size_t>(i)];
+    }
+    return result;
+}
+
+std::int32_t
+CountDistribution::at_penetration(const double penetration) const {
+    return static_cast<std::int32_t>(
+        std::lround(std::clamp(penetration, 0.0, 1.0) * cards)
+    );
+}
+
+} // namespace core
@@ -0,0 +1,438 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <utility>
+// own
+#include "core/cards.hpp"
+#include "core/engine.hpp"
+
+namespace core {
+
+namespace {
+std::size_t index_of(const std::int32_t handle) {
+    return static_cast<std::size_t>(handle);
+}
+} // namespace
+
+void EngineObserver::card_dealt(const std::int32_t, const std::int32_t) { }
+
+void EngineObserver::joker_dealt(const std::int32_t) { }
+
+void EngineObserver::shoe_finished(const std::int32_t) { }
+
+void EngineObserver::round_finished(const std::int32_t) { }
+
+Engine::Engine(const std::uint64_t seed)
+    : rng(seed) { }
+
+void Engine::set_policy(const SlotSampler::policy value) {
+    sampler.set_policy(value);
+}
+
+void Engine::clear() {
+    flags.clear();
+    running_counts.clear();
+    current_cards.clear();
+    deck_counts.clear();
+    positions.clear();
+    quizzed_counters.clear();
+    counters.clear();
+    rank_counts.clear();
+    shoes.clear();
+    machines.clear();
+    rounds.clear();
+    order.clear();
+    free_handles.clear();
+    available.clear();
+    jokers.clear();
+    sampler.clear();
+    order_index = 0;
+    last_picked = -1;
+}
+
+void Engine::restart() {
+    jokers.clear();
+    available.clear();
+    sampler.clear();
+    order_index = 0;
+    last_picked = -1;
+    for (const std::int32_t handle : order) {
+        const std::size_t i = index_of(handle);
+        running_counts[i] = {};
+        rank_counts[i] = {};
+        current_cards[i] = -1;
+        rounds[i].set_seats(round_seats);
+        set_flag(handle, Finished, false);
+        if (has_flag(handle, Active)) {
+            set_available(handle, true);
+        }
+    }
+}
+
+std::int32_t Engine::add_slot(const bool active) {
+    std::int32_t handle;
+    if (free_handles.empty()) {
+        handle = static_cast<std::int32_t>(flags.size());
+        flags.push_back(0);
+        running_counts.emplace_back();
+        current_cards.push_back(-1);
+        deck_counts.push_back(0);
+        positions.push_back(0);
+        quizzed_counters.push_back(0);
+        counters.emplace_back();
+        rank_counts.emplace_back();
+        shoes.emplace_back();
+        machines.emplace_back();
+        rounds.emplace_back();
+    } else {
+        handle = free_handles.back();
+        free_handles.pop_back();
+    }
+    const std::size_t i = index_of(handle);
+    flags[i] = Used;
+    running_counts[i] = {};
+    rank_counts[i] = {};
+    current_cards[i] = -1;
+    deck_counts[i] = active ? 1 : 0;
+    quizzed_counters[i] = 0;
+    counters[i] = CounterSet();
+    shoes[i].clear();
+    machines[i].clear();
+    rounds[i].set_seats(round_seats);
+    positions[i] = slot_count();
+    order.push_back(handle);
+    if (active) {
+        activate(handle);
+    }
+    return handle;
+}
+
+void Engine::remove_slot(const std::int32_t handle) {
+    const std::size_t i = index_of(handle);
+    const auto position = static_cast<std::size_t>(positions[i]);
+    order.erase(order.begin() + static_cast<std::ptrdiff_t>(position));
+    update_positions(position);
+    available.erase(handle);
+    jokers.erase(handle);
+    sampler.forget(handle);
+    flags[i] = 0;
+    shoes[i].clear();
+    machines[i].clear();
+    free_handles.push_back(handle);
+}
+
+void Engine::swap_slots(const std::int32_t first, const std::int32_t second) {
+    std::swap(positions[index_of(first)], positions[index_of(second)]);
+    order[static_cast<std::size_t>(positions[index_of(first)])] = first;
+    order[static_cast<std::size_t>(positions[index_of(second)])] = second;
+}
+
+void Engine::activate(const std::int32_t handle) {
+    if (!has_flag(handle, Used) || has_flag(handle, Active)) {
+        return;
+    }
+    set_flag(handle, Active, true);
+    running_counts[index_of(handle)] = {};
+    rank_counts[index_of(handle)] = {};
+    set_available(handle, true);
+}
+
+void Engine::set_strategy(const std::int32_t handle, const Strategy& strategy) {
+    const std::size_t i = index_of(handle);
+    counters[i].set(0, strategy);
+    running_counts[i] = CounterSet::assign(
+        running_counts[i], 0, strategy.count(rank_counts[i])
+    );
+}
+
+void Engine::set_side_counts(
+    const std::int32_t handle, const std::span<const Strategy> side_counts
+) {
+    const std::size_t i = index_of(handle);
+    CounterSet& set = counters[i];
+    set.truncate(1);
+    for (std::int32_t counter = 1; counter < CounterSet::max_counters;
+         ++counter) {
+        running_counts[i] = CounterSet::reset(running_counts[i], counter);
+        const auto side = static_cast<std::size_t>(counter - 1);
+        if (side < side_counts.size()) {
+            set.set(counter, side_counts[side]);
+            running_counts[i] = CounterSet::assign(
+                running_counts[i], counter,
+                side_counts[side].count(rank_counts[i])
+            );
+        }
+    }
+    if (quizzed_counters[i] >= set.size()) {
+        quizzed_counters[i] = 0;
+    }
+}
+
+std::int32_t Engine::get_counter_count(const std::int32_t handle) const {
+    return counters[index_of(handle)].size();
+}
+
+void Engine::set_deck_count(
+    const std::int32_t handle, const std::int32_t deck_count
+) {
+    deck_counts[index_of(handle)] = deck_count;
+}
+
+void Engine::reshuffle(const std::int32_t handle) {
+    const std::size_t i = index_of(handle);
+    if (infinite) {
+        shoes[i].clear();
+        machines[i].clear();
+    } else if (continuous) {
+        shoes[i].clear();
+        machines[i].fill(deck_counts[i], shuffle_delay);
+    } else {
+        machines[i].clear();
+        shoes[i].fill(deck_counts[i], rng);
+    }
+    rounds[i].set_seats(round_seats);
+    if (has_flag(handle, Finished)) {
+        set_flag(handle, Finished, false);
+        set_available(handle, has_flag(handle, Active));
+    }
+}
+
+void Engine::deal(const std::int32_t handle) {
+    const std::size_t i = index_of(handle);
+    std::int32_t card;
+    if (infinite) {
+        card = infinite_card(current_cards[i], positions[i], slot_count(), rng);
+    } else if (!machines[i].empty()) {
+        card = machines[i].draw(rng);
+    } else if (shoes[i].empty()) {
+        set_flag(handle, Finished, true);
+        set_available(handle, false);
+        if (observer) {
+            observer->shoe_finished(handle);
+        }
+        return;
+    } else {
+        card = shoes[i].draw();
+    }
+    current_cards[i] = card;
+    if (is_joker(card)) {
+        const std::int32_t count = counters[i].size();
+        // a single counter leaves the random sequence as it was
+        quizzed_counters[i] = count > 1 ? rng.bounded(count) : 0;
+        jokers.insert(handle);
+        set_available(handle, false);
+        if (observer) {
+            observer->card_dealt(handle, card);
+            observer->joker_dealt(handle);
+        }
+        return;
+    }
+    const std::int32_t rank = rank_of(card);
+    running_counts[i] = counters[i].update(running_counts[i], rank);
+    ++rank_counts[i][static_cast<std::size_t>(rank - Ace)];
+    const bool settled = rounds[i].add(rank);
+    if (observer) {
+        observer->card_dealt(handle, card);
+        if (settled) {
+            observer->round_finished(handle);
+        }
+    }
+}
+
+bool Engine::tick() {
+    if (available.empty()) {
+        return false;
+    }
+    if (current_mode == mode::Simultaneous) {
+        // a slot may drop itself from the set while dealing, which moves the
+        // last member into its position; walking backwards never skips one
+        for (std::int32_t i = available.size() - 1; i >= 0; --i) {
+            deal(available.at(i));
+        }
+        return true;
+    }
+    const std::int32_t handle = pick_next();
+    sampler.dealt(handle);
+    deal(handle);
+    return true;
+}
+
+bool Engine::answer(
+    const std::int32_t handle, const std::int32_t running_count
+) {
+    return settle(
+        handle,
+        running_count == get_running_count(handle, get_quizzed_counter(handle))
+    );
+}
+
+bool Engine::answer_true_count(
+    const std::int32_t handle, const std::int32_t true_count,
+    const Rounding rounding
+) {
+    const double exact = get_true_count(handle, get_quizzed_counter(handle));
+    return settle(handle, true_count == round_true_count(exact, rounding));
+}
+
+bool Engine::answer_play(
+    const std::int32_t handle, const Deviation& deviation,
+    const std::int8_t index, const Play play, const Rounding rounding
+) {
+    const double exact = get_true_count(handle, get_quizzed_counter(handle));
+    const std::int32_t true_count = round_true_count(exact, rounding);
+    return settle(handle, play == play_at(deviation, index, true_count));
+}
+
+bool Engine::settle(const std::int32_t handle, const bool correct) {
+    if (jokers.erase(handle)) {
+        set_available(handle, true);
+        sampler.answered(handle, correct);
+    }
+    return correct;
+}
+
+bool Engine::is_fake(const std::int32_t handle) const {
+    return !has_flag(handle, Active);
+}
+
+bool Engine::is_available(const std::int32_t handle) const {
+    return available.contains(handle);
+}
+
+bool Engine::is_quizzing(const std::int32_t handle) const {
+    return jokers.contains(handle);
+}
+
+bool Engine::is_finished(const std::int32_t handle) const {
+    return has_flag(handle, Finished);
+}
+
+std::int32_t Engine::get_running_count(
+    const std::int32_t handle, const std::int32_t counter
+) const {
+    return CounterSet::extract(running_counts[index_of(handle)], counter);
+}
+
+const RankCounts& Engine::get_rank_counts(const std::int32_t handle) const {
+    return rank_counts[index_of(handle)];
+}
+
+std::int32_t Engine::count_with(
+    const std::int32_t handle, const Strategy& strategy
+) const {
+    return strategy.count(rank_counts[index_of(handle)]);
+}
+
+double Engine::get_true_count(
+    const std::int32_t handle, const std::int32_t counter
+) const {
+    const Shoe& shoe = shoes[index_of(handle)];
+    return true_count(
+        get_running_count(handle, counter),
+        get_strategy(handle, counter).get_scale(),
+        infinite || shoe.size() == 0 ? deck_size - jokers_per_deck
+                                     : shoe.standard_remaining()
+    );
+}
+
+std::int32_t Engine::get_quizzed_counter(const std::int32_t handle) const {
+    return quizzed_counters[index_of(handle)];
+}
+
+std::int32_t Engine::get_current_card(const std::int32_t handle) const {
+    return current_cards[index_of(handle)];
+}
+
+std::int32_t Engine::get_deck_count(const std::int32_t handle) const {
+    return deck_counts[index_of(handle)];
+}
+
+const Strategy& Engine::get_strategy(
+    const std::int32_t handle, const std::int32_t counter
+) const {
+    return counters[index_of(handle)].get(counter);
+}
+
+const Shoe& Engine::get_shoe(const std::int32_t handle) const {
+    return shoes[index_of(handle)];
+}
+
+const ContinuousShoe& Engine::get_machine(const std::int32_t handle) const {
+    return machines[index_of(handle)];
+}
+
+const BlackjackRound& Engine::get_round(const std::int32_t handle) const {
+    return rounds[index_of(handle)];
+}
+
+bool Engine::has_flag(const std::int32_t handle, const flag value) const {
+    return flags[index_of(handle)] & value;
+}
+
+void Engine::set_flag(
+    const std::int32_t handle, const flag value, const bool on
+) {
+    std::uint8_t& bits = flags[index_of(handle)];
+    bits = static_cast<std::uint8_t>(on ? bits | value : bits & ~value);
+}
+
+void Engine::set_available(const std::int32_t handle, const bool value) {
+    if (value) {
+        available.insert(handle);
+    } else {
+        available.erase(handle);
+    }
+    sampler.set_active(handle, value);
+}
+
+void Engine::update_positions(const std::size_t from) {
+    for (std::size_t position = from; position < order.size(); ++position) {
+        positions[index_of(order[position])]
+            = static_cast<std::int32_t>(position);
+    }
+}
+
+std::int32_t Engine::pick_next() {
+    if (current_mode == mode::Random) {
+        last_picked = available.pick_other(last_picked, rng);
+        return last_picked;
+    }
+    if (current_mode == mode::Adaptive) {
+        last_picked = sampler.pick(rng);
+        if (last_picked < 0) {
+            last_picked = available.pick(rng);
+        }
+        return last_picked;
+    }
+    std::int32_t handle;
+    do {
+        order_index %= slot_count();
+        handle = order[static_cast<std::size_t>(order_index++)];
+    } while (!available.contains(handle));
+    return handle;
+}
+
+} // namespace core
@@ -0,0 +1,245 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+// own
+#include "core/evaluator.hpp"
+#include "core/random.hpp"
+
+namespace core {
+
+namespace {
+using Effects = std::array<double, rank_count>;
+
+/**
+ * Griffin's effects of removal on the player expectation in percent, single
+ * deck, Ace..King. Removing a five helps the player the most.
+ */
+constexpr Effects betting_effects { -0.61, 0.38, 0.44,  0.55,  0.69,
+                                    0.46,  0.28, 0.00,  -0.18, -0.51,
+                                    -0.51, -0.51, -0.51 };
+
+/** Insurance pays 2:1, so a ten removed weighs -9 against +4 for the rest. */
+constexpr Effects insurance_effects { 4,  4,  4,  4,  4, 4, 4,
+                                      4,  4, -9, -9, -9, -9 };
+
+/*
+ * Stand and double decisions, approximated by the ranks that improve the
+ * hand when drawn: removing them favours standing, or hurts the double.
+ * Each vector sums to zero over a deck.
+ */
+constexpr std::array<Effects, 3> playing_effects { {
+    // stand on hard 16 against a ten: Ace..5 save the hand
+    { 8, 8, 8, 8, 8, -5, -5, -5, -5, -5, -5, -5, -5 },
+    // stand on hard 15 against a ten: Ace..6 save the hand
+    { 7, 7, 7, 7, 7, 7, -6, -6, -6, -6, -6, -6, -6 },
+    // double hard 10 against a ten: Ace, 9 and tens make a strong hand
+    { -7, 6, 6, 6, 6, 6, 6, 6, -7, -7, -7, -7, -7 },
+} };
+
+constexpr std::size_t decision_count = 2 + playing_effects.size();
+
+/** Shoes dealt from one seed, the unit of work handed to the workers. */
+constexpr std::int64_t block_size = 256;
+
+/** Running sums for the correlation of x with several y. */
+struct Moments {
+    void merge(const Moments& other) {
+        n += other.n;
+        sx += other.sx;
+        sxx += other.sxx;
+        for (std::size_t i = 0; i < decision_count; ++i) {
+            sy[i] += other.sy[i];
+            syy[i] += other.syy[i];
+            sxy[i] += other.sxy[i];
+        }
+    }
+
+    [[nodiscard]] double correlation(const std::size_t i) const {
+        const double cov = n * sxy[i] - sx * sy[i];
+        const double var_x = n * sxx - sx * sx;
+        const double var_y = n * syy[i] - sy[i] * sy[i];
+        if (var_x <= 0.0 || var_y <= 0.0) {
+            return 0.0;
+        }
+        return cov / std::sqrt(var_x * var_y);
+    }
+
+    double n = 0.0;
+    double sx = 0.0;
+    double sxx = 0.0;
+    std::array<double, decision_count> sy {};
+    std::array<double, decision_count> syy {};
+    std::array<double, decision_count> sxy {};
+};
+
+std::array<Effects, decision_count> decisions() {
+    std::array<Effects, decision_count> result;
+    result[0] = betting_effects;
+    result[1] = insurance_effects;
+    std::copy(
+        playing_effects.begin(), playing_effects.end(), result.begin() + 2
+    );
+    return result;
+}
+
+void deal_block(
+    const Weights& weights, const EvaluationParameters& parameters,
+    const std::int64_t block, const std::vector<std::int8_t>& deck,
+    std::vector<std::int8_t>& shoe, Moments& moments
+) {
+    static const std::array<Effects, decision_count> effects = decisions();
+    // every block starts from the sorted deck, whichever worker runs it
+    shoe = deck;
+    const auto size = static_cast<std::int32_t>(shoe.size());
+    const auto cut = static_cast<std::int32_t>(parameters.penetration * size);
+    const std::int64_t shoes = std::min(
+        block_size, parameters.shoes - block * block_size
+    );
+    // unbalanced counts drift by this much per card on average; removing
+    // the drift turns them into their balanced equivalent
+    const double drift = static_cast<double>(Strategy(weights).deck_sum())
+        / (deck_size - jokers_per_deck);
+
+    Random rng(
+        parameters.seed
+        ^ (static_cast<std::uint64_t>(block) * 0x9e3779b97f4a7c15ULL)
+    );
+    for (std::int64_t s = 0; s < shoes; ++s) {
+        std::int32_t running = 0;
+        std::array<double, decision_count> ideal {};
+        for (std::int32_t i = 0; i < cut; ++i) {
+            // deal by a lazy Fisher-Yates pass, the rest stays unshuffled
+            auto& card = shoe[static_cast<std::size_t>(i)];
+            std::swap(
+                card, shoe[static_cast<std::size_t>(i + rng.bounded(size - i))]
+            );
+            const auto rank = static_cast<std::size_t>(card);
+            running += weights[rank];
+            for (std::size_t d = 0; d < decision_count; ++d) {
+                ideal[d] += effects[d][rank];
+            }
+            if ((i + 1) % parameters.sample_interval) {
+                continue;
+            }
+            const double decks = static_cast<double>(size - i - 1)
+                / (deck_size - jokers_per_deck);
+            const double true_count = (running - drift * (i + 1)) / decks;
+            moments.n += 1.0;
+            moments.sx += true_count;
+            moments.sxx += true_count * true_count;
+            for (std::size_t d = 0; d < decision_count; ++d) {
+                const double y = ideal[d] / decks;
+                moments.sy[d] += y;
+                moments.syy[d] += y * y;
+                moments.sxy[d] += true_count * y;
+            }
+        }
+    }
+}
+} // namespace
+
+std::optional<Evaluation> evaluate(
+    const Weights& weights, const EvaluationParameters& parameters,
+    const std::atomic<bool>* cancel
+) {
+    std::vector<std::int8_t> deck;
+    for (std::int32_t d = 0; d < parameters.deck_count; ++d) {
+        for (std::int32_t suit = 0; suit < 4; ++suit) {
+            for (std::int32_t rank = 0; rank < rank_count; ++rank) {
+                deck.push_back(static_cast<std::int8_t>(rank));
+            }
+        }
+    }
+    const std::int64_t blocks
+        = (parameters.shoes + block_size - 1) / block_size;
+    const std::int32_t threads = std::clamp<std::int32_t>(
+        parameters.threads, 1,
+        static_cast<std::int32_t>(std::min<std::int64_t>(blocks, 1024))
+    );
+
+    std::vector<Moments> results(static_cast<std::size_t>(blocks));
+    std::vector<std::vector<std::int8_t>> shoes(
+        static_cast<std::size_t>(threads)
+    );
+    const bool complete = parallel_for(
+        blocks, 1, threads,
+        [&](const std::int32_t worker, const std::int64_t begin,
+            const std::int64_t end) {
+            for (std::int64_t block = begin; block < end; ++block) {
+                deal_block(
+                    weights, parameters, block, deck,
+                    shoes[static_cast<std::size_t>(worker)],
+                    results[static_cast<std::size_t>(block)]
+                );
+            }
+        },
+        cancel
+    );
+    if (!complete) {
+        return std::nullopt;
+    }
+
+    // merging in block order keeps the sums independent of the scheduling
+    Moments total;
+    for (const Moments& moments : results) {
+        total.merge(moments);
+    }
+    Evaluation evaluation;
+    evaluation.samples = static_cast<std::int64_t>(total.n);
+    evaluation.betting_correlation = total.correlation(0);
+    evaluation.insurance_correlation = total.correlation(1);
+    for (std::size_t d = 2; d < decision_count; ++d) {
+        evaluation.playing_efficiency += total.correlation(d);
+    }
+    evaluation.playing_efficiency
+        /= static_cast<double>(playing_effects.size());
+    if (total.n > 0.0) {
+        const double mean = total.sx / total.n;
+        evaluation.count_variance = total.sxx / total.n - mean * mean;
+    }
+    return evaluation;
+}
+
+std::optional<Evaluation> EvaluationCache::find(const Weights& weights) const {
+    const std::lock_guard lock(mutex);
+    const auto found = evaluations.find(weights);
+    if (found == evaluations.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+void EvaluationCache::insert(
+    const Weights& weights, const Evaluation& evaluation
+) {
+    const std::lock_guard lock(mutex);
+    evaluations.insert_or_assign(weights, evaluation);
+}
+
+} // namespace core
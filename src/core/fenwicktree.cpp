@@ -0,0 +1,94 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+// own
+#include "core/fenwicktree.hpp"
+
+namespace core {
+
+void FenwickTree::resize(const std::int32_t size) {
+    weights.resize(static_cast<std::size_t>(size), 0.0);
+    rebuild();
+}
+
+std::int32_t FenwickTree::size() const noexcept {
+    return static_cast<std::int32_t>(weights.size());
+}
+
+void FenwickTree::set(const std::int32_t index, const double weight) {
+    const double delta = weight - weights[static_cast<std::size_t>(index)];
+    weights[static_cast<std::size_t>(index)] = weight;
+    for (std::int32_t i = index + 1; i <= size(); i += i & -i) {
+        tree[static_cast<std::size_t>(i)] += delta;
+    }
+}
+
+double FenwickTree::weight(const std::int32_t index) const {
+    return weights[static_cast<std::size_t>(index)];
+}
+
+double FenwickTree::total() const {
+    double sum = 0.0;
+    for (std::int32_t i = size(); i > 0; i -= i & -i) {
+        sum += tree[static_cast<std::size_t>(i)];
+    }
+    return sum;
+}
+
+std::int32_t FenwickTree::find(double value) const {
+    std::int32_t step = 1;
+    while (step * 2 <= size()) {
+        step *= 2;
+    }
+    std::int32_t position = 0;
+    for (; step > 0; step /= 2) {
+        if (position + step <= size()
+            && tree[static_cast<std::size_t>(position + step)] <= value) {
+            position += step;
+            value -= tree[static_cast<std::size_t>(position)];
+        }
+    }
+    return std::min(position, size() - 1);
+}
+
+void FenwickTree::rebuild() {
+    tree.assign(weights.size() + 1, 0.0);
+    for (std::int32_t i = 1; i <= size(); ++i) {
+        tree[static_cast<std::size_t>(i)]
+            += weights[static_cast<std::size_t>(i - 1)];
+        if (const std::int32_t parent = i + (i & -i); parent <= size()) {
+            tree[static_cast<std::size_t>(parent)]
+                += tree[static_cast<std::size_t>(i)];
+        }
+    }
+}
+
+void FenwickTree::assign(std::vector<double> values) {
+    weights = std::move(values);
+    rebuild();
+}
+
+} // namespace core
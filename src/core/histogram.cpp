@@ -0,0 +1,98 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <cmath>
+// own
+#include "core/histogram.hpp"
+
+namespace core {
+
+void Histogram::add(const std::int32_t value, const std::int64_t times) {
+    if (bins.empty()) {
+        offset = value;
+        bins.assign(1, 0);
+    } else if (value < offset) {
+        bins.insert(bins.begin(), static_cast<std::size_t>(offset - value), 0);
+        offset = value;
+    } else if (value > max()) {
+        bins.resize(static_cast<std::size_t>(value - offset) + 1, 0);
+    }
+    bins[static_cast<std::size_t>(value - offset)] += times;
+    total += times;
+}
+
+void Histogram::merge(const Histogram& other) {
+    for (std::size_t i = 0; i < other.bins.size(); ++i) {
+        if (other.bins[i]) {
+            add(other.offset + static_cast<std::int32_t>(i), other.bins[i]);
+        }
+    }
+}
+
+std::int64_t Histogram::at(const std::int32_t value) const noexcept {
+    if (bins.empty() || value < min() || value > max()) {
+        return 0;
+    }
+    return bins[static_cast<std::size_t>(value - offset)];
+}
+
+double Histogram::mean() const noexcept {
+    if (!total) {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (std::size_t i = 0; i < bins.size(); ++i) {
+        sum += static_cast<double>(bins[i])
+            * (offset + static_cast<double>(i));
+    }
+    return sum / static_cast<double>(total);
+}
+
+double Histogram::variance() const noexcept {
+    if (!total) {
+        return 0.0;
+    }
+    const double average = mean();
+    double sum = 0.0;
+    for (std::size_t i = 0; i < bins.size(); ++i) {
+        const double delta = offset + static_cast<double>(i) - average;
+        sum += static_cast<double>(bins[i]) * delta * delta;
+    }
+    return sum / static_cast<double>(total);
+}
+
+std::int32_t Histogram::quantile(const double probability) const noexcept {
+    const double target = std::ceil(probability * static_cast<double>(total));
+    std::int64_t seen = 0;
+    for (std::size_t i = 0; i < bins.size(); ++i) {
+        seen += bins[i];
+        if (static_cast<double>(seen) >= target && seen > 0) {
+            return offset + static_cast<std::int32_t>(i);
+        }
+    }
+    return max();
+}
+
+} // namespace core
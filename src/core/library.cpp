@@ -0,0 +1,263 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <array>
+#include <istream>
+#include <ostream>
+#include <utility>
+// own
+#include "core/library.hpp"
+
+namespace core {
+
+namespace {
+using traits = std::char_traits<char>;
+
+constexpr std::size_t field_count = 2 + rank_count;
+constexpr std::string_view header
+    = "name,description,A,2,3,4,5,6,7,8,9,10,J,Q,K\n";
+
+/** Parse a decimal with up to two fraction digits, in hundredths. */
+bool parse_hundredths(std::string_view text, std::int32_t& value) {
+    const bool negative = !text.empty() && text.front() == '-';
+    if (!text.empty() && (text.front() == '-' || text.front() == '+')) {
+        text.remove_prefix(1);
+    }
+    const std::size_t point = text.find('.');
+    const std::string_view whole = text.substr(0, point);
+    const std::string_view fraction = point == std::string_view::npos
+        ? std::string_view {}
+        : text.substr(point + 1);
+    if (whole.empty() || whole.size() > 3 || fraction.size() > 2
+        || (point != std::string_view::npos && fraction.empty())) {
+        return false;
+    }
+    value = 0;
+    for (const char c : whole) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        value = 10 * value + (c - '0');
+    }
+    for (std::size_t i = 0; i < 2; ++i) {
+        const char c = i < fraction.size() ? fraction[i] : '0';
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        value = 10 * value + (c - '0');
+    }
+    value = negative ? -value : value;
+    return value >= -100 * max_weight && value <= 100 * max_weight;
+}
+} // namespace
+
+bool parse_points(
+    const std::span<const std::string_view, rank_count> texts,
+    Weights& weights, std::int32_t& scale
+) {
+    std::array<std::int32_t, rank_count> hundredths {};
+    for (std::size_t i = 0; i < rank_count; ++i) {
+        if (!parse_hundredths(texts[i], hundredths[i])) {
+            return false;
+        }
+    }
+    for (std::int32_t candidate = 1; candidate <= max_scale; candidate *= 2) {
+        const bool whole = std::all_of(
+            hundredths.cbegin(), hundredths.cend(),
+            [candidate](const std::int32_t value) {
+                return value * candidate % 100 == 0;
+            }
+        );
+        if (whole) {
+            for (std::size_t i = 0; i < rank_count; ++i) {
+                weights[i] = hundredths[i] * candidate / 100;
+            }
+            scale = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string format_points(const std::int32_t value, const std::int32_t scale) {
+    const std::int32_t magnitude = value < 0 ? -value : value;
+    std::string result = (value < 0 ? "-" : "")
+        + std::to_string(magnitude / scale);
+    std::int32_t fraction = magnitude % scale * 100 / scale;
+    if (fraction) {
+        result += '.';
+        result += static_cast<char>('0' + fraction / 10);
+        fraction %= 10;
+        if (fraction) {
+            result += static_cast<char>('0' + fraction);
+        }
+    }
+    return result;
+}
+
+LibraryReader::LibraryReader(std::istream& input)
+    : input(input.rdbuf()) { }
+
+std::optional<LibraryEntry> LibraryReader::next() {
+    if (!error.empty() || !read_record()) {
+        return std::nullopt;
+    }
+    if (!header_checked) {
+        header_checked = true;
+        if (fields.front() == "name" && !read_record()) {
+            return std::nullopt;
+        }
+    }
+    if (fields.size() != field_count) {
+        fail(
+            "expected " + std::to_string(field_count) + " fields, found "
+            + std::to_string(fields.size())
+        );
+        return std::nullopt;
+    }
+    if (fields[0].empty()) {
+        fail("empty name");
+        return std::nullopt;
+    }
+    LibraryEntry entry;
+    std::array<std::string_view, rank_count> texts;
+    std::copy(fields.cbegin() + 2, fields.cend(), texts.begin());
+    if (!parse_points(texts, entry.weights, entry.scale)) {
+        fail(
+            "weights must be numbers from " + std::to_string(-max_weight)
+            + " to " + std::to_string(max_weight)
+            + " in steps of no less than a quarter"
+        );
+        return std::nullopt;
+    }
+    entry.name = std::move(fields[0]);
+    entry.description = std::move(fields[1]);
+    return entry;
+}
+
+bool LibraryReader::read_record() {
+    fields.clear();
+    if (input == nullptr) {
+        return false;
+    }
+    traits::int_type c = input->sbumpc();
+    while (c == '\n' || c == '\r') {
+        line += c == '\n';
+        c = input->sbumpc();
+    }
+    if (traits::eq_int_type(c, traits::eof())) {
+        return false;
+    }
+    record_line = line;
+    std::string field;
+    bool quoting = false;
+    bool quoted = false;
+    for (;; c = input->sbumpc()) {
+        if (quoting) {
+            if (traits::eq_int_type(c, traits::eof())) {
+                return fail("unterminated quote");
+            }
+            if (c == '"' && input->sgetc() == '"') {
+                input->sbumpc();
+                field.push_back('"');
+            } else if (c == '"') {
+                quoting = false;
+            } else {
+                line += c == '\n';
+                field.push_back(traits::to_char_type(c));
+            }
+        } else if (c == ',') {
+            fields.push_back(std::move(field));
+            field.clear();
+            quoted = false;
+        } else if (c == '\r' && input->sgetc() == '\n') {
+            // the line ends with the next character
+        } else if (c == '\n' || traits::eq_int_type(c, traits::eof())) {
+            line += c == '\n';
+            fields.push_back(std::move(field));
+            return true;
+        } else if (c == '"' && field.empty() && !quoted) {
+            quoting = true;
+            quoted = true;
+        } else if (c == '"' || quoted) {
+            return fail("stray quote");
+        } else {
+            field.push_back(traits::to_char_type(c));
+        }
+    }
+}
+
+bool LibraryReader::fail(std::string message) {
+    error = std::move(message);
+    return false;
+}
+
+LibraryWriter::LibraryWriter(std::ostream& output)
+    : output(output) {
+    this->output << header;
+}
+
+void LibraryWriter::write(const LibraryEntry& entry) {
+    write_field(entry.name);
+    output.put(',');
+    write_field(entry.description);
+    for (const std::int32_t weight : entry.weights) {
+        output << ',' << format_points(weight, entry.scale);
+    }
+    output.put('\n');
+}
+
+void LibraryWriter::write_field(const std::string_view field) {
+    if (field.find_first_of(",\"\r\n") == std::string_view::npos) {
+        output << field;
+        return;
+    }
+    output.put('"');
+    for (const char c : field) {
+        if (c == '"') {
+            output.put('"');
+        }
+        output.put(c);
+    }
+    output.put('"');
+}
+
+std::optional<std::vector<LibraryEntry>>
+read_library(std::istream& input, std::string& error) {
+    LibraryReader reader(input);
+    std::vector<LibraryEntry> entries;
+    while (auto entry = reader.next()) {
+        entries.push_back(std::move(*entry));
+    }
+    if (!reader.get_error().empty()) {
+        error = "line " + std::to_string(reader.get_line()) + ": "
+            + reader.get_error();
+        return std::nullopt;
+    }
+    return entries;
+}
+
+} // namespace core
@@ -0,0 +1,186 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+// own
+#include "core/builtins.hpp"
+#include "core/optimiser.hpp"
+#include "core/random.hpp"
+
+namespace core {
+
+namespace {
+/** Ace..9 and the tens, which always share one weight. */
+constexpr std::int32_t group_count = Ten;
+
+constexpr std::size_t ten_index = Ten - Ace;
+
+void set_group(
+    Weights& weights, const std::int32_t group, const std::int32_t value
+) {
+    if (group == group_count - 1) {
+        std::fill(weights.begin() + ten_index, weights.end(), value);
+    } else {
+        weights[static_cast<std::size_t>(group)] = value;
+    }
+}
+
+/** Divide by the greatest common divisor of all weights. */
+Weights normalised(Weights weights) {
+    std::int32_t divisor = 0;
+    for (const std::int32_t weight : weights) {
+        divisor = std::gcd(divisor, weight);
+    }
+    if (divisor > 1) {
+        for (std::int32_t& weight : weights) {
+            weight /= divisor;
+        }
+    }
+    return weights;
+}
+
+/**
+ * Move one group by one step, then restore the balance by walking other
+ * non-ten groups towards it.
+ *
+ * @return false if the move leaves the search space
+ */
+bool neighbour(
+    Weights& weights, const OptimiserParameters& parameters, Random& rng
+) {
+    const std::int32_t group = rng.bounded(group_count);
+    const std::int32_t value = weights[static_cast<std::size_t>(group)]
+        + (rng.bounded(2) ? 1 : -1);
+    if (std::abs(value) > parameters.level) {
+        return false;
+    }
+    set_group(weights, group, value);
+    if (!parameters.balanced) {
+        return true;
+    }
+    Strategy strategy(weights);
+    for (std::int32_t attempt = 0; strategy.deck_sum() && attempt < 64;
+         ++attempt) {
+        const std::int32_t other = rng.bounded(group_count - 1);
+        if (other == group) {
+            continue;
+        }
+        auto& weight = weights[static_cast<std::size_t>(other)];
+        const std::int32_t step = strategy.deck_sum() > 0 ? -1 : 1;
+        if (std::abs(weight + step) <= parameters.level) {
+            weight += step;
+            strategy = Strategy(weights);
+        }
+    }
+    return !strategy.deck_sum();
+}
+
+void remember(
+    std::vector<Candidate>& best, const Candidate& candidate,
+    const std::size_t keep
+) {
+    const auto same = [&candidate](const Candidate& other) {
+        return other.weights == candidate.weights;
+    };
+    if (std::any_of(best.begin(), best.end(), same)) {
+        return;
+    }
+    const auto position = std::find_if(
+        best.begin(), best.end(),
+        [&candidate](const Candidate& other) {
+            return other.score < candidate.score;
+        }
+    );
+    best.insert(position, candidate);
+    if (best.size() > keep) {
+        best.pop_back();
+    }
+}
+} // namespace
+
+std::vector<Candidate> optimise(
+    const OptimiserParameters& parameters, const OptimiserProgress& progress,
+    const std::atomic<bool>* cancel
+) {
+    EvaluationCache cache;
+    const auto score = [&](const Weights& weights) -> std::optional<double> {
+        if (const auto cached = cache.find(weights)) {
+            return cached->betting_correlation;
+        }
+        const auto evaluation
+            = evaluate(weights, parameters.evaluation, cancel);
+        if (!evaluation) {
+            return std::nullopt;
+        }
+        cache.insert(weights, *evaluation);
+        return evaluation->betting_correlation;
+    };
+
+    std::vector<Candidate> best;
+    Random rng(parameters.seed);
+    // Hi-Lo is a level one balanced count, so it fits every search space
+    Candidate current { builtin_strategies()[1].weights, 0.0 };
+    if (const auto initial = score(current.weights)) {
+        current.score = *initial;
+    } else {
+        return best;
+    }
+    remember(best, current, parameters.keep);
+
+    const double cooling = parameters.steps > 1
+        ? std::pow(
+              parameters.end_temperature / parameters.start_temperature,
+              1.0 / (parameters.steps - 1)
+          )
+        : 1.0;
+    double temperature = parameters.start_temperature;
+    for (std::int32_t step = 0; step < parameters.steps; ++step) {
+        Weights proposal = current.weights;
+        if (neighbour(proposal, parameters, rng)) {
+            proposal = normalised(proposal);
+            const auto proposal_score = score(proposal);
+            if (!proposal_score) {
+                break;
+            }
+            const Candidate candidate { proposal, *proposal_score };
+            remember(best, candidate, parameters.keep);
+            const double delta = candidate.score - current.score;
+            if (delta >= 0.0
+                || rng.uniform() < std::exp(delta / temperature)) {
+                current = candidate;
+            }
+        }
+        temperature *= cooling;
+        if (progress) {
+            progress(step + 1, best.front());
+        }
+    }
+    return best;
+}
+
+} // namespace core
@@ -0,0 +1,237 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+// own
+#include "core/parallel.hpp"
+
+namespace core {
+
+namespace {
+/** Chunks still owned by one worker, [first, last). */
+struct alignas(64) WorkBlock {
+    std::mutex mutex;
+    std::int64_t first = 0;
+    std::int64_t last = 0;
+};
+
+bool take_own(WorkBlock& block, std::int64_t& chunk) {
+    const std::lock_guard lock(block.mutex);
+    if (block.first == block.last) {
+        return false;
+    }
+    chunk = block.first++;
+    return true;
+}
+
+bool steal(std::vector<WorkBlock>& blocks, const std::size_t thief) {
+    // the largest block is only a hint, it may shrink before it is locked
+    std::size_t victim = thief;
+    std::int64_t largest = 0;
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        const std::lock_guard lock(blocks[i].mutex);
+        if (blocks[i].last - blocks[i].first > largest) {
+            largest = blocks[i].last - blocks[i].first;
+            victim = i;
+        }
+    }
+    if (victim == thief) {
+        return false;
+    }
+    std::int64_t first;
+    std::int64_t last;
+    {
+        const std::lock_guard lock(blocks[victim].mutex);
+        const std::int64_t left = blocks[victim].last - blocks[victim].first;
+        if (left == 0) {
+            return true;
+        }
+        last = blocks[victim].last;
+        first = last - (left + 1) / 2;
+        blocks[victim].last = first;
+    }
+    const std::lock_guard lock(blocks[thief].mutex);
+    blocks[thief].first = first;
+    blocks[thief].last = last;
+    return true;
+}
+
+/** A parallel_for() call waiting for helpers, owned by its caller. */
+struct Loop {
+    std::function<void(std::int32_t)> work;
+    /** Helpers the loop can use, on top of its caller. */
+    std::int32_t wanted = 0;
+    /** Helpers that took a worker index so far. */
+    std::int32_t joined = 0;
+    /** Helpers still running the loop. */
+    std::int32_t active = 0;
+    std::condition_variable done;
+};
+
+/**
+ * @brief Threads shared by all parallel_for() calls of the process.
+ *
+ * One helper per hardware thread besides the caller, started on first use.
+ * Callers always work on their own loop, so loops that overlap, as an
+ * evaluation, an optimisation and an index simulation from the GUI may,
+ * share the helpers instead of each starting a full set of threads.
+ */
+class WorkerPool {
+public:
+    static WorkerPool& instance() {
+        static WorkerPool pool(hardware_threads() - 1);
+        return pool;
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    ~WorkerPool() {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /** Run @p loop on the caller as worker 0 and on the free helpers. */
+    void run(Loop& loop) {
+        if (loop.wanted > 0 && !threads.empty()) {
+            {
+                const std::lock_guard lock(mutex);
+                queue.push_back(&loop);
+            }
+            wake.notify_all();
+        }
+        loop.work(0);
+        std::unique_lock lock(mutex);
+        // helpers that did not join by now have nothing left to do
+        const auto queued = std::find(queue.begin(), queue.end(), &loop);
+        if (queued != queue.end()) {
+            queue.erase(queued);
+        }
+        loop.done.wait(lock, [&loop] { return loop.active == 0; });
+    }
+
+private:
+    explicit WorkerPool(const std::int32_t size) {
+        threads.reserve(static_cast<std::size_t>(std::max(0, size)));
+        for (std::int32_t i = 0; i < size; ++i) {
+            threads.emplace_back([this] { serve(); });
+        }
+    }
+
+    void serve() {
+        std::unique_lock lock(mutex);
+        while (true) {
+            wake.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            Loop& loop = *queue.front();
+            const std::int32_t worker = ++loop.joined;
+            if (loop.joined == loop.wanted) {
+                queue.pop_front();
+            }
+            ++loop.active;
+            lock.unlock();
+            loop.work(worker);
+            lock.lock();
+            if (--loop.active == 0) {
+                loop.done.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    /** Loops that can use more helpers, oldest first. */
+    std::deque<Loop*> queue;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+};
+} // namespace
+
+std::int32_t hardware_threads() noexcept {
+    return std::max(
+        1, static_cast<std::int32_t>(std::thread::hardware_concurrency())
+    );
+}
+
+bool parallel_for(
+    const std::int64_t count, std::int64_t grain, std::int32_t threads,
+    const ParallelBody& body, const std::atomic<bool>* cancel
+) {
+    if (count <= 0) {
+        return true;
+    }
+    grain = std::max<std::int64_t>(1, grain);
+    const std::int64_t chunks = (count + grain - 1) / grain;
+    threads = static_cast<std::int32_t>(
+        std::clamp<std::int64_t>(threads, 1, chunks)
+    );
+
+    std::vector<WorkBlock> blocks(static_cast<std::size_t>(threads));
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        const auto n = static_cast<std::int64_t>(blocks.size());
+        const auto index = static_cast<std::int64_t>(i);
+        blocks[i].first = chunks * index / n;
+        blocks[i].last = chunks * (index + 1) / n;
+    }
+    std::atomic<bool> cancelled { false };
+
+    Loop loop;
+    loop.wanted = threads - 1;
+    loop.work = [&](const std::int32_t worker) {
+        const auto self = static_cast<std::size_t>(worker);
+        std::int64_t chunk;
+        while (true) {
+            while (take_own(blocks[self], chunk)) {
+                if (cancel && cancel->load(std::memory_order_relaxed)) {
+                    cancelled = true;
+                    return;
+                }
+                const std::int64_t begin = chunk * grain;
+                body(worker, begin, std::min(count, begin + grain));
+            }
+            if (!steal(blocks, self)) {
+                return;
+            }
+        }
+    };
+
+    WorkerPool::instance().run(loop);
+    return !cancelled;
+}
+
+} // namespace core
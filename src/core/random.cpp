@@ -0,0 +1,83 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <random>
+// own
+#include "core/random.hpp"
+
+namespace core {
+
+Random::Random(const std::uint64_t seed) noexcept { this->seed(seed); }
+
+void Random::seed(std::uint64_t value) noexcept {
+    // expand the seed with splitmix64, which never yields an all-zero state
+    for (std::uint64_t& word : state) {
+        value += 0x9e3779b97f4a7c15ULL;
+        std::uint64_t z = value;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        word = z ^ (z >> 31);
+    }
+}
+
+std::uint64_t Random::entropy() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+std::int32_t Random::bounded(const std::int32_t bound) noexcept {
+    const auto range = static_cast<std::uint32_t>(bound);
+    std::uint64_t product = (operator()() >> 32) * range;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        const std::uint32_t threshold = (0U - range) % range;
+        while (low < threshold) {
+            product = (operator()() >> 32) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::int32_t>(product >> 32);
+}
+
+void Random::jump() noexcept {
+    constexpr std::array<std::uint64_t, 4> polynomial {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL,
+        0x39abdc4529b1661cULL
+    };
+    std::array<std::uint64_t, 4> jumped {};
+    for (const std::uint64_t word : polynomial) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if (word & (std::uint64_t { 1 } << bit)) {
+                for (std::size_t i = 0; i < jumped.size(); ++i) {
+                    jumped[i] ^= state[i];
+                }
+            }
+            operator()();
+        }
+    }
+    state = jumped;
+}
+
+} // namespace core
@@ -0,0 +1,178 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <array>
+#include <utility>
+// own
+#include "core/cards.hpp"
+#include "core/shoe.hpp"
+
+namespace core {
+
+namespace {
+void shuffle_range(
+    std::vector<std::int32_t>& cards, const std::size_t first,
+    const std::size_t last, Random& rng
+) {
+    for (std::size_t i = last - first; i > 1; --i) {
+        const auto j = static_cast<std::size_t>(
+            rng.bounded(static_cast<std::int32_t>(i))
+        );
+        std::swap(cards[first + i - 1], cards[first + j]);
+    }
+}
+} // namespace
+
+void shuffle_shoe(
+    std::vector<std::int32_t>& deck, const std::int32_t deck_count,
+    const std::int32_t shuffle_coefficient, Random& rng
+) {
+    deck.clear();
+    if (deck_count <= 0 || shuffle_coefficient <= 0) {
+        return;
+    }
+    const std::int32_t total = deck_count * deck_size;
+    const std::int32_t jokers = deck_count * jokers_per_deck;
+    const std::int32_t threshold = total / (deck_count * shuffle_coefficient);
+    const std::int32_t gap = std::max(0, threshold - 1);
+    // with positions shifted by the mandatory gaps, a valid placement is any
+    // choice of distinct slots among the free ones
+    const std::int32_t free_slots = total - jokers * gap;
+
+    // jokers are added while merging, the rest goes behind them
+    deck.resize(static_cast<std::size_t>(total));
+    auto out = static_cast<std::size_t>(jokers);
+    for (std::int32_t i = 0; i < deck_count; ++i) {
+        for (std::int32_t rank = Ace; rank <= King; ++rank) {
+            for (std::int32_t suit = Clubs; suit <= Spades; ++suit) {
+                deck[out++] = make_card(suit, rank);
+            }
+        }
+    }
+    if (free_slots < jokers) {
+        for (std::int32_t i = 0; i < jokers; ++i) {
+            deck[static_cast<std::size_t>(i)] = make_card(i & 1, Joker);
+        }
+        shuffle_range(deck, 0, deck.size(), rng);
+        return;
+    }
+    shuffle_range(deck, static_cast<std::size_t>(jokers), deck.size(), rng);
+
+    // selection sampling picks the joker slots in increasing order, so the
+    // cards can be merged in place: the write position never passes the
+    // read position
+    std::array<std::int32_t, 2> colours { deck_count, deck_count };
+    std::size_t write = 0;
+    auto read = static_cast<std::size_t>(jokers);
+    std::int32_t chosen = 0;
+    for (std::int32_t slot = 0; slot < free_slots && chosen < jokers; ++slot) {
+        if (rng.bounded(free_slots - slot) >= jokers - chosen) {
+            continue;
+        }
+        const auto joker_position
+            = static_cast<std::size_t>(slot + (chosen + 1) * gap);
+        while (write < joker_position) {
+            deck[write++] = deck[read++];
+        }
+        const std::int32_t colour
+            = rng.bounded(colours[0] + colours[1]) < colours[0] ? Black : Red;
+        --colours[static_cast<std::size_t>(colour)];
+        deck[write++] = make_card(colour, Joker);
+        ++chosen;
+    }
+    while (write < deck.size()) {
+        deck[write++] = deck[read++];
+    }
+}
+
+std::int32_t infinite_card(
+    const std::int32_t last, const std::int32_t slot_index,
+    const std::int32_t slot_count, Random& rng
+) {
+    if (rng.bounded(deck_size) == 0) {
+        return make_card(rng.bounded(2) ? Red : Black, Joker);
+    }
+    const double k = 1.0
+        + static_cast<double>(slot_index + 1) / std::max(1, slot_count);
+    const bool have_last = last >= 0 && !is_joker(last);
+
+    std::int32_t suit;
+    if (have_last && rng.uniform() < 1.0 / (4.0 * k)) {
+        suit = suit_of(last);
+    } else {
+        std::array<std::int32_t, Spades + 1> suits {};
+        std::int32_t suit_count = 0;
+        for (std::int32_t s = Clubs; s <= Spades; ++s) {
+            if (!have_last || s != suit_of(last)) {
+                suits[static_cast<std::size_t>(suit_count++)] = s;
+            }
+        }
+        suit = suits[static_cast<std::size_t>(rng.bounded(suit_count))];
+    }
+
+    std::int32_t rank;
+    if (have_last && rng.uniform() < 1.0 / (13.0 * k)) {
+        rank = rank_of(last);
+    } else {
+        std::array<std::int32_t, rank_count> ranks {};
+        std::int32_t count = 0;
+        for (std::int32_t r = Ace; r <= King; ++r) {
+            if (!have_last || r != rank_of(last)) {
+                ranks[static_cast<std::size_t>(count++)] = r;
+            }
+        }
+        rank = ranks[static_cast<std::size_t>(rng.bounded(count))];
+    }
+    return make_card(suit, rank);
+}
+
+void Shoe::fill(
+    const std::int32_t deck_count, Random& rng,
+    const std::int32_t shuffle_coefficient
+) {
+    shuffle_shoe(cards, deck_count, shuffle_coefficient, rng);
+    position = 0;
+    const std::int32_t decks = cards.empty() ? 0 : deck_count;
+    ranks_left.fill(4 * decks);
+    standard_total = decks * (deck_size - jokers_per_deck);
+    standard_left = standard_total;
+}
+
+void Shoe::clear() noexcept {
+    cards.clear();
+    position = 0;
+    ranks_left = {};
+    standard_left = 0;
+    standard_total = 0;
+}
+
+double Shoe::penetration() const noexcept {
+    return standard_total
+        ? 1.0 - static_cast<double>(standard_left) / standard_total
+        : 0.0;
+}
+
+} // namespace core
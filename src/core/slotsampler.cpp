@@ -0,0 +1,172 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+// own
+#include "core/random.hpp"
+#include "core/slotsampler.hpp"
+
+namespace core {
+
+namespace {
+/** Weight of the latest joker answer in the moving error rate. */
+constexpr double error_smoothing = 0.3;
+/** Weight multiplier of a slot that is always answered wrong. */
+constexpr double error_gain = 4.0;
+/** Renormalise before the staleness exponent loses precision. */
+constexpr double max_exponent = 20.0;
+} // namespace
+
+void SlotSampler::set_policy(const policy value) {
+    if (current_policy != value) {
+        current_policy = value;
+        renormalise();
+    }
+}
+
+SlotSampler::policy SlotSampler::get_policy() const noexcept {
+    return current_policy;
+}
+
+void SlotSampler::clear() {
+    stats.clear();
+    tree.resize(0);
+    active_count = 0;
+    decay_count = 0;
+    tick = 0;
+    epoch = 0;
+}
+
+void SlotSampler::set_active(const std::int32_t handle, const bool active) {
+    ensure(handle);
+    slot_stats& slot = stats[static_cast<std::size_t>(handle)];
+    if (slot.active == active) {
+        return;
+    }
+    slot.active = active;
+    active_count += active ? 1 : -1;
+    if (active) {
+        // the slot starts as fresh as if it had just been dealt
+        slot.last_dealt = tick;
+    }
+    update(handle);
+    if (active_count > 2 * decay_count || 2 * active_count < decay_count) {
+        renormalise();
+    }
+}
+
+void SlotSampler::forget(const std::int32_t handle) {
+    ensure(handle);
+    set_active(handle, false);
+    stats[static_cast<std::size_t>(handle)] = slot_stats();
+}
+
+void SlotSampler::dealt(const std::int32_t handle) {
+    ensure(handle);
+    stats[static_cast<std::size_t>(handle)].last_dealt = ++tick;
+    update(handle);
+    if (decay * static_cast<double>(tick - epoch) > max_exponent) {
+        renormalise();
+    }
+}
+
+void SlotSampler::answered(const std::int32_t handle, const bool correct) {
+    ensure(handle);
+    double& rate = stats[static_cast<std::size_t>(handle)].error_rate;
+    rate += error_smoothing * ((correct ? 0.0 : 1.0) - rate);
+    update(handle);
+}
+
+std::int32_t SlotSampler::pick(Random& rng) const {
+    const double total = tree.total();
+    if (active_count == 0 || total <= 0.0) {
+        return -1;
+    }
+    const std::int32_t handle = tree.find(rng.uniform() * total);
+    if (stats[static_cast<std::size_t>(handle)].active) {
+        return handle;
+    }
+    // rounding left a sliver of weight next to an inactive slot, take the
+    // nearest active one instead
+    const auto count = static_cast<std::int32_t>(stats.size());
+    for (std::int32_t offset = 1; offset < count; ++offset) {
+        for (const std::int32_t other : { handle - offset, handle + offset }) {
+            if (other >= 0 && other < count
+                && stats[static_cast<std::size_t>(other)].active) {
+                return other;
+            }
+        }
+    }
+    return -1;
+}
+
+void SlotSampler::ensure(const std::int32_t handle) {
+    if (static_cast<std::size_t>(handle) >= stats.size()) {
+        stats.resize(static_cast<std::size_t>(handle) + 1);
+        tree.resize(static_cast<std::int32_t>(stats.size()));
+    }
+}
+
+double SlotSampler::weight_of(const slot_stats& slot) const {
+    if (!slot.active) {
+        return 0.0;
+    }
+    double weight = 1.0;
+    if (current_policy == policy::ErrorRate
+        || current_policy == policy::Mixed) {
+        weight *= 1.0 + error_gain * slot.error_rate;
+    }
+    if (current_policy == policy::Staleness
+        || current_policy == policy::Mixed) {
+        // clamp slots that were left alone for ages, they win anyway
+        weight *= std::exp(std::min(
+            2.0 * max_exponent,
+            -decay * static_cast<double>(slot.last_dealt - epoch)
+        ));
+    }
+    return weight;
+}
+
+void SlotSampler::update(const std::int32_t handle) {
+    tree.set(handle, weight_of(stats[static_cast<std::size_t>(handle)]));
+}
+
+void SlotSampler::renormalise() {
+    // a slot left alone for as many ticks as there are slots becomes twice
+    // as likely as the one dealt right now
+    decay_count = active_count;
+    decay = std::numbers::ln2 / std::max(1, decay_count);
+    epoch = tick;
+    std::vector<double> weights;
+    weights.reserve(stats.size());
+    for (const slot_stats& slot : stats) {
+        weights.push_back(weight_of(slot));
+    }
+    tree.assign(std::move(weights));
+}
+
+} // namespace core
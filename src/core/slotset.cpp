@@ -0,0 +1,92 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// own
+#include "core/random.hpp"
+#include "core/slotset.hpp"
+
+namespace core {
+
+bool SlotSet::insert(const std::int32_t handle) {
+    if (contains(handle)) {
+        return false;
+    }
+    if (static_cast<std::size_t>(handle) >= positions.size()) {
+        positions.resize(static_cast<std::size_t>(handle) + 1, -1);
+    }
+    positions[static_cast<std::size_t>(handle)] = size();
+    members.push_back(handle);
+    return true;
+}
+
+bool SlotSet::erase(const std::int32_t handle) {
+    if (!contains(handle)) {
+        return false;
+    }
+    const std::int32_t position = positions[static_cast<std::size_t>(handle)];
+    const std::int32_t last = members.back();
+    members[static_cast<std::size_t>(position)] = last;
+    positions[static_cast<std::size_t>(last)] = position;
+    members.pop_back();
+    positions[static_cast<std::size_t>(handle)] = -1;
+    return true;
+}
+
+bool SlotSet::contains(const std::int32_t handle) const noexcept {
+    return handle >= 0 && static_cast<std::size_t>(handle) < positions.size()
+        && positions[static_cast<std::size_t>(handle)] >= 0;
+}
+
+std::int32_t SlotSet::size() const noexcept {
+    return static_cast<std::int32_t>(members.size());
+}
+
+bool SlotSet::empty() const noexcept { return members.empty(); }
+
+void SlotSet::clear() {
+    for (const std::int32_t handle : members) {
+        positions[static_cast<std::size_t>(handle)] = -1;
+    }
+    members.clear();
+}
+
+std::int32_t SlotSet::at(const std::int32_t index) const {
+    return members[static_cast<std::size_t>(index)];
+}
+
+std::int32_t SlotSet::pick(Random& rng) const {
+    return at(rng.bounded(size()));
+}
+
+std::int32_t SlotSet::pick_other(const std::int32_t handle, Random& rng) const {
+    if (size() < 2 || !contains(handle)) {
+        return pick(rng);
+    }
+    // draw among the first size - 1 members and let the excluded handle's
+    // position stand in for the last one
+    const std::int32_t candidate = at(rng.bounded(size() - 1));
+    return candidate == handle ? members.back() : candidate;
+}
+
+} // namespace core
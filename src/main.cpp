@@ -31,7 +31,9 @@
 #include <KAboutData>
 #include <KLocalizedString>
 // own
+#include "configstore.hpp"
 #include "mainwindow.hpp"
+#include "strategy/strategyregistry.hpp"
 
 int main(int argc, char* argv[]) {
     const QApplication app(argc, argv);
@@ -60,10 +62,46 @@ int main(int argc, char* argv[]) {
     KAboutData::setApplicationData(about_data);
 
     QCommandLineParser parser;
+    const QCommandLineOption import_option(
+        QStringLiteral("import"),
+        i18n("Add the strategies of a CSV library and quit."),
+        i18n("file")
+    );
+    const QCommandLineOption export_option(
+        QStringLiteral("export"),
+        i18n("Write the custom strategies to a CSV library and quit."),
+        i18n("file")
+    );
+    parser.addOption(import_option);
+    parser.addOption(export_option);
     about_data.setupCommandLine(&parser);
     parser.process(app);
     about_data.processCommandLine(&parser);
 
+    if (parser.isSet(import_option) || parser.isSet(export_option)) {
+        StrategyRegistry& registry = StrategyRegistry::instance();
+        QString error;
+        if (parser.isSet(import_option)) {
+            const qint32 count
+                = registry.import_library(parser.value(import_option), error);
+            if (count < 0) {
+                qCritical("%s", qPrintable(error));
+                return 1;
+            }
+            qInfo("%s", qPrintable(i18np(
+                "Imported %1 strategy.", "Imported %1 strategies.", count
+            )));
+        }
+        if (parser.isSet(export_option)
+            && !registry.export_library(parser.value(export_option), error)) {
+            qCritical("%s", qPrintable(error));
+            return 1;
+        }
+        // there is no event loop to write in the background
+        ConfigStore::instance().flush();
+        return 0;
+    }
+
     auto window = std::make_unique<MainWindow>();
     window->show();
 
@@ -34,6 +34,7 @@
 #include <QPainter>
 #include <QPushButton>
 #include <QSettings>
+#include <QSpinBox>
 #include <QStandardPaths>
 #include <QStatusBar>
 #include <QSvgRenderer>
@@ -133,6 +134,9 @@ void MainWindow::setup_actions() {
     diff->addLevel(
         new KGameDifficultyLevel(3, QByteArray("Random"), i18n("Random"))
     );
+    diff->addLevel(
+        new KGameDifficultyLevel(5, QByteArray("Adaptive"), i18n("Adaptive"))
+    );
     diff->addLevel(new KGameDifficultyLevel(
         10, QByteArray("Simultaneous"), i18n("Simultaneous")
     ));
@@ -259,6 +263,12 @@ void MainWindow::configure_settings() {
     indexing->setChecked(opts.indexing());
     generalForm->addRow(indexing, new QLabel(i18n("Use card indexing")));
 
+    auto* show_penetration = new QCheckBox(general);
+    show_penetration->setChecked(opts.show_penetration());
+    generalForm->addRow(
+        show_penetration, new QLabel(i18n("Show penetration with the index"))
+    );
+
     auto* strategy_hint = new QCheckBox(general);
     strategy_hint->setChecked(opts.strategy_hint());
     generalForm->addRow(
@@ -285,6 +295,58 @@ void MainWindow::configure_settings() {
     infinity_mode->setChecked(opts.infinity_mode());
     generalForm->addRow(infinity_mode, new QLabel(i18n("Infinity mode")));
 
+    auto* continuous_shuffle = new QCheckBox(general);
+    continuous_shuffle->setChecked(opts.continuous_shuffle());
+    generalForm->addRow(
+        continuous_shuffle, new QLabel(i18n("Continuous shuffling machine"))
+    );
+
+    auto* shuffle_delay = new QSpinBox(general);
+    shuffle_delay->setRange(0, 200);
+    shuffle_delay->setValue(opts.shuffle_delay());
+    shuffle_delay->setEnabled(continuous_shuffle->isChecked());
+    connect(
+        continuous_shuffle, &QCheckBox::toggled, shuffle_delay,
+        &QSpinBox::setEnabled
+    );
+    generalForm->addRow(
+        shuffle_delay, new QLabel(i18n("Cards dealt before discards return"))
+    );
+
+    auto* blackjack_seats = new QSpinBox(general);
+    blackjack_seats->setRange(0, 3);
+    blackjack_seats->setSpecialValueText(i18n("Off"));
+    blackjack_seats->setValue(opts.blackjack_seats());
+    generalForm->addRow(
+        blackjack_seats, new QLabel(i18n("Blackjack players per slot"))
+    );
+
+    auto* adaptive_policy = new QComboBox(general);
+    adaptive_policy->addItem(i18n("Uniform"));
+    adaptive_policy->addItem(i18n("Error rate"));
+    adaptive_policy->addItem(i18n("Time since last card"));
+    adaptive_policy->addItem(i18n("Error rate and time since last card"));
+    adaptive_policy->setCurrentIndex(opts.adaptive_policy());
+    generalForm->addRow(
+        adaptive_policy, new QLabel(i18n("Adaptive mode weighting"))
+    );
+
+    auto* quiz_type = new QComboBox(general);
+    quiz_type->addItem(i18n("Running count"));
+    quiz_type->addItem(i18n("True count"));
+    quiz_type->addItem(i18n("Either"));
+    quiz_type->addItem(i18n("Playing deviations"));
+    quiz_type->setCurrentIndex(opts.quiz_type());
+    generalForm->addRow(quiz_type, new QLabel(i18n("Jokers ask for")));
+
+    // in the order of core::Rounding
+    auto* rounding = new QComboBox(general);
+    rounding->addItem(i18n("Round down"));
+    rounding->addItem(i18n("Round toward zero"));
+    rounding->addItem(i18n("Round to nearest"));
+    rounding->setCurrentIndex(opts.true_count_rounding());
+    generalForm->addRow(rounding, new QLabel(i18n("True count rounding")));
+
     // theme page with preview
     auto* theme_page = new QWidget;
     auto* theme_layout = new QVBoxLayout(theme_page);
@@ -408,16 +470,26 @@ void MainWindow::configure_settings() {
     layout->addWidget(buttons);
 
     auto apply = [&] {
+        // the table follows all of them in one pass
+        opts.begin_changes();
         opts.set_indexing(indexing->isChecked());
+        opts.set_show_penetration(show_penetration->isChecked());
         opts.set_strategy_hint(strategy_hint->isChecked());
         opts.set_training(training->isChecked());
         opts.set_show_time(show_time->isChecked());
         opts.set_show_score(show_score->isChecked());
         opts.set_show_speed(show_speed->isChecked());
         opts.set_infinity_mode(infinity_mode->isChecked());
+        opts.set_continuous_shuffle(continuous_shuffle->isChecked());
+        opts.set_shuffle_delay(shuffle_delay->value());
+        opts.set_blackjack_seats(blackjack_seats->value());
+        opts.set_adaptive_policy(adaptive_policy->currentIndex());
+        opts.set_quiz_type(quiz_type->currentIndex());
+        opts.set_true_count_rounding(rounding->currentIndex());
         opts.set_card_theme(theme_combo->currentData().toString());
         // opts.set_card_background(bg_color);
         opts.set_card_border(border_color);
+        opts.end_changes();
     };
 
     connect(buttons, &QDialogButtonBox::accepted, &dialog, [&]() {
@@ -21,10 +21,50 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+// Qt
+#include <QJsonObject>
+// std
+#include <utility>
+// own
+#include "configstore.hpp"
 #include "settings.hpp"
 
+namespace {
+/** ConfigStore group of the settings. */
+constexpr QLatin1String saved_settings("settings");
+
+void save(const char* key, const QJsonValue& value) {
+    ConfigStore::instance().set_value(saved_settings, key, value);
+}
+} // namespace
+
 Settings::Settings(QObject* parent)
-    : QObject(parent) { }
+    : QObject(parent) {
+    const QJsonObject saved = ConfigStore::instance().group(saved_settings);
+    indexing_ = saved.value("indexing").toBool(indexing_);
+    show_penetration_
+        = saved.value("show_penetration").toBool(show_penetration_);
+    strategy_hint_ = saved.value("strategy_hint").toBool(strategy_hint_);
+    is_training_ = saved.value("training").toBool(is_training_);
+    show_time_ = saved.value("show_time").toBool(show_time_);
+    show_score_ = saved.value("show_score").toBool(show_score_);
+    show_speed_ = saved.value("show_speed").toBool(show_speed_);
+    infinity_mode_ = saved.value("infinity_mode").toBool(infinity_mode_);
+    continuous_shuffle_
+        = saved.value("continuous_shuffle").toBool(continuous_shuffle_);
+    shuffle_delay_ = saved.value("shuffle_delay").toInt(shuffle_delay_);
+    blackjack_seats_
+        = saved.value("blackjack_seats").toInt(blackjack_seats_);
+    adaptive_policy_ = saved.value("adaptive_policy").toInt(adaptive_policy_);
+    quiz_type_ = saved.value("quiz_type").toInt(quiz_type_);
+    true_count_rounding_
+        = saved.value("true_count_rounding").toInt(true_count_rounding_);
+    card_theme_ = saved.value("card_theme").toString(card_theme_);
+    const QColor border(saved.value("card_border").toString());
+    if (border.isValid()) {
+        card_border_ = border;
+    }
+}
 
 Settings& Settings::instance() {
     static Settings inst;
@@ -33,6 +73,8 @@ Settings& Settings::instance() {
 
 bool Settings::indexing() const { return indexing_; }
 
+bool Settings::show_penetration() const { return show_penetration_; }
+
 bool Settings::strategy_hint() const { return strategy_hint_; }
 
 bool Settings::training() const { return is_training_; }
@@ -45,65 +87,173 @@ bool Settings::show_speed() const { return show_speed_; }
 
 bool Settings::infinity_mode() const { return infinity_mode_; }
 
+bool Settings::continuous_shuffle() const { return continuous_shuffle_; }
+
+int Settings::shuffle_delay() const { return shuffle_delay_; }
+
+int Settings::blackjack_seats() const { return blackjack_seats_; }
+
+int Settings::adaptive_policy() const { return adaptive_policy_; }
+
+int Settings::quiz_type() const { return quiz_type_; }
+
+int Settings::true_count_rounding() const { return true_count_rounding_; }
+
 QString Settings::card_theme() const { return card_theme_; }
 
 // QColor Settings::card_background() const { return card_background_; }
 
 QColor Settings::card_border() const { return card_border_; }
 
+void Settings::begin_changes() { ++change_depth; }
+
+void Settings::end_changes() {
+    if (--change_depth > 0 || !pending_changes) {
+        return;
+    }
+    emit changed(std::exchange(pending_changes, {}));
+}
+
+void Settings::touch(const Change change) {
+    if (change_depth > 0) {
+        pending_changes |= change;
+    } else {
+        emit changed(change);
+    }
+}
+
 void Settings::set_indexing(const bool value) {
     if (indexing_ != value) {
         indexing_ = value;
+        save("indexing", value);
         emit indexing_changed(value);
+        touch(Change::Indexing);
+    }
+}
+
+void Settings::set_show_penetration(const bool value) {
+    if (show_penetration_ != value) {
+        show_penetration_ = value;
+        save("show_penetration", value);
+        emit show_penetration_changed(value);
+        touch(Change::ShowPenetration);
     }
 }
 
 void Settings::set_strategy_hint(const bool value) {
     if (strategy_hint_ != value) {
         strategy_hint_ = value;
+        save("strategy_hint", value);
         emit strategy_hint_changed(value);
+        touch(Change::StrategyHint);
     }
 }
 
 void Settings::set_training(const bool value) {
     if (is_training_ != value) {
         is_training_ = value;
+        save("training", value);
         emit training_changed(value);
+        touch(Change::Training);
     }
 }
 
 void Settings::set_show_time(const bool value) {
     if (show_time_ != value) {
         show_time_ = value;
+        save("show_time", value);
         emit show_time_changed(value);
+        touch(Change::ShowTime);
     }
 }
 
 void Settings::set_show_score(const bool value) {
     if (show_score_ != value) {
         show_score_ = value;
+        save("show_score", value);
         emit show_score_changed(value);
+        touch(Change::ShowScore);
     }
 }
 
 void Settings::set_show_speed(const bool value) {
     if (show_speed_ != value) {
         show_speed_ = value;
+        save("show_speed", value);
         emit show_speed_changed(value);
+        touch(Change::ShowSpeed);
     }
 }
 
 void Settings::set_infinity_mode(const bool value) {
     if (infinity_mode_ != value) {
         infinity_mode_ = value;
+        save("infinity_mode", value);
         emit infinity_mode_changed(value);
+        touch(Change::InfinityMode);
+    }
+}
+
+void Settings::set_continuous_shuffle(const bool value) {
+    if (continuous_shuffle_ != value) {
+        continuous_shuffle_ = value;
+        save("continuous_shuffle", value);
+        emit continuous_shuffle_changed(value);
+        touch(Change::ContinuousShuffle);
+    }
+}
+
+void Settings::set_shuffle_delay(const int value) {
+    if (shuffle_delay_ != value) {
+        shuffle_delay_ = value;
+        save("shuffle_delay", value);
+        emit shuffle_delay_changed(value);
+        touch(Change::ShuffleDelay);
+    }
+}
+
+void Settings::set_blackjack_seats(const int value) {
+    if (blackjack_seats_ != value) {
+        blackjack_seats_ = value;
+        save("blackjack_seats", value);
+        emit blackjack_seats_changed(value);
+        touch(Change::BlackjackSeats);
+    }
+}
+
+void Settings::set_adaptive_policy(const int value) {
+    if (adaptive_policy_ != value) {
+        adaptive_policy_ = value;
+        save("adaptive_policy", value);
+        emit adaptive_policy_changed(value);
+        touch(Change::AdaptivePolicy);
+    }
+}
+
+void Settings::set_quiz_type(const int value) {
+    if (quiz_type_ != value) {
+        quiz_type_ = value;
+        save("quiz_type", value);
+        emit quiz_type_changed(value);
+        touch(Change::QuizType);
+    }
+}
+
+void Settings::set_true_count_rounding(const int value) {
+    if (true_count_rounding_ != value) {
+        true_count_rounding_ = value;
+        save("true_count_rounding", value);
+        emit true_count_rounding_changed(value);
+        touch(Change::TrueCountRounding);
     }
 }
 
 void Settings::set_card_theme(const QString& value) {
     if (card_theme_ != value) {
         card_theme_ = value;
+        save("card_theme", value);
         emit card_theme_changed(value);
+        touch(Change::CardTheme);
     }
 }
 
@@ -117,6 +267,8 @@ void Settings::set_card_theme(const QString& value) {
 void Settings::set_card_border(const QColor& value) {
     if (card_border_ != value) {
         card_border_ = value;
+        save("card_border", value.name(QColor::HexArgb));
         emit card_border_changed(value);
+        touch(Change::CardBorder);
     }
 }
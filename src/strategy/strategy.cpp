@@ -24,26 +24,72 @@
 
 // Qt
 #include <QTextEdit>
+// std
+#include <algorithm>
 // own
 #include "strategy/strategy.hpp"
+#include "core/library.hpp"
 
-qint32 Strategy::update_weight(const qint32 current_weight, const qint32 rank) {
-    return current_weight + weights[rank - 1];
+qint32 Strategy::update_weight(
+    const qint32 current_weight, const qint32 rank
+) const {
+    return counting.update(current_weight, rank);
 }
 
 Strategy::Strategy(
-    QString name, QString description, QVector<qint32> weights,
-    const bool custom
+    QString name, QString description, const QVector<qint32> weights,
+    const bool custom, const qint32 scale
 )
     : custom(custom)
-    , weights(std::move(weights))
     , name(std::move(name))
-    , description(std::move(description)) { }
+    , description(std::move(description)) {
+    core::Weights values {};
+    const auto count = qMin<qsizetype>(weights.size(), core::rank_count);
+    std::copy_n(weights.cbegin(), count, values.begin());
+    counting = core::Strategy(values, scale);
+}
 
-QString Strategy::get_name() const { return name; }
+Strategy::Strategy(
+    const core::BuiltinStrategy& builtin, const char* description
+)
+    : custom(false)
+    , counting(builtin.weights, builtin.scale)
+    , builtin(&builtin)
+    , builtin_description(description) { }
 
-QString Strategy::get_description() const { return description; }
+QString Strategy::get_name() const {
+    if (builtin) {
+        return QString::fromUtf8(
+            builtin->name.data(), static_cast<qsizetype>(builtin->name.size())
+        );
+    }
+    return name;
+}
+
+QString Strategy::get_description() const {
+    return builtin ? QString::fromUtf8(builtin_description) : description;
+}
 
 bool Strategy::is_custom() const noexcept { return custom; }
 
-qint32 Strategy::get_weights(const qint32 id) const { return weights[id]; }
+qint32 Strategy::get_weights(const qint32 id) const {
+    return counting.get_weight(id + core::Ace);
+}
+
+qint32 Strategy::get_scale() const noexcept { return counting.get_scale(); }
+
+QString Strategy::format_count(const qint32 units) const {
+    return QString::fromStdString(core::format_points(units, get_scale()));
+}
+
+const core::Strategy& Strategy::get_counting() const noexcept {
+    return counting;
+}
+
+const core::IndexTable* Strategy::get_builtin_indices() const noexcept {
+    if (!builtin) {
+        return nullptr;
+    }
+    const auto index = builtin - core::builtin_strategies().data();
+    return core::builtin_index_tables[static_cast<std::size_t>(index)];
+}
@@ -0,0 +1,175 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <utility>
+// own
+#include "strategy/strategyfiltermodel.hpp"
+
+StrategyFilterModel::StrategyFilterModel(QObject* parent)
+    : QSortFilterProxyModel(parent) {
+    setSortCaseSensitivity(Qt::CaseInsensitive);
+}
+
+void StrategyFilterModel::setSourceModel(QAbstractItemModel* source) {
+    for (const auto& connection : std::as_const(source_connections)) {
+        disconnect(connection);
+    }
+    source_connections.clear();
+    // connected before the proxy itself, so new rows are indexed by the
+    // time they are filtered
+    if (source) {
+        source_connections << connect(
+            source, &QAbstractItemModel::rowsInserted, this,
+            [this](const QModelIndex&, const int first, const int last) {
+                index_rows(first, last);
+            }
+        );
+        source_connections << connect(
+            source, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex& top_left, const QModelIndex& bottom) {
+                for (int row = top_left.row(); row <= bottom.row(); ++row) {
+                    if (names.value(row) != source_name(row)) {
+                        rebuild();
+                        return;
+                    }
+                }
+            }
+        );
+        source_connections << connect(
+            source, &QAbstractItemModel::rowsRemoved, this,
+            &StrategyFilterModel::rebuild
+        );
+        source_connections << connect(
+            source, &QAbstractItemModel::rowsMoved, this,
+            &StrategyFilterModel::rebuild
+        );
+        source_connections << connect(
+            source, &QAbstractItemModel::modelReset, this,
+            &StrategyFilterModel::rebuild
+        );
+    }
+    QSortFilterProxyModel::setSourceModel(source);
+    rebuild();
+}
+
+void StrategyFilterModel::set_query(const QString& text) {
+    const QString folded = text.toCaseFolded();
+    if (folded == query) {
+        return;
+    }
+    query = folded;
+    match_rows();
+    invalidateRowsFilter();
+}
+
+bool StrategyFilterModel::filterAcceptsRow(
+    const int source_row, const QModelIndex& source_parent
+) const {
+    if (query.isEmpty() || source_parent.isValid()) {
+        return true;
+    }
+    if (source_row < matches.size()) {
+        return matches.testBit(source_row);
+    }
+    // not indexed yet
+    return source_name(source_row).contains(query);
+}
+
+void StrategyFilterModel::index_rows(const int first, const int last) {
+    if (first != names.size()) {
+        // only appends are incremental
+        rebuild();
+        return;
+    }
+    for (int row = first; row <= last; ++row) {
+        const QString name = source_name(row);
+        names.push_back(name);
+        for (qsizetype length = 1; length <= max_gram; ++length) {
+            for (qsizetype i = 0; i + length <= name.size(); ++i) {
+                QVector<int>& rows
+                    = grams[gram_key(QStringView(name).mid(i, length))];
+                if (rows.isEmpty() || rows.last() != row) {
+                    rows.push_back(row);
+                }
+            }
+        }
+    }
+    if (!query.isEmpty()) {
+        matches.resize(static_cast<qsizetype>(names.size()));
+        for (int row = first; row <= last; ++row) {
+            matches.setBit(row, names[row].contains(query));
+        }
+    }
+}
+
+void StrategyFilterModel::rebuild() {
+    names.clear();
+    grams.clear();
+    const int count = sourceModel() ? sourceModel()->rowCount() : 0;
+    if (count > 0) {
+        index_rows(0, count - 1);
+    }
+    match_rows();
+}
+
+void StrategyFilterModel::match_rows() {
+    matches.clear();
+    if (query.isEmpty()) {
+        return;
+    }
+    matches.resize(static_cast<qsizetype>(names.size()));
+    // every match contains each n-gram of the query, so the rarest one
+    // bounds the rows left to check
+    const qsizetype length = std::min(query.size(), max_gram);
+    const QVector<int>* candidates = nullptr;
+    for (qsizetype i = 0; i + length <= query.size(); ++i) {
+        const auto found
+            = grams.constFind(gram_key(QStringView(query).mid(i, length)));
+        if (found == grams.cend()) {
+            return;
+        }
+        if (!candidates || found->size() < candidates->size()) {
+            candidates = &*found;
+        }
+    }
+    for (const int row : *candidates) {
+        if (query.size() <= max_gram || names[row].contains(query)) {
+            matches.setBit(row);
+        }
+    }
+}
+
+QString StrategyFilterModel::source_name(const int row) const {
+    return sourceModel()->index(row, 0).data().toString().toCaseFolded();
+}
+
+quint64 StrategyFilterModel::gram_key(const QStringView gram) noexcept {
+    auto key = static_cast<quint64>(gram.size());
+    for (const QChar c : gram) {
+        key = key << 16 | c.unicode();
+    }
+    return key;
+}
@@ -24,65 +24,110 @@
 
 // Qt
 #include <QBoxLayout>
+#include <QComboBox>
 #include <QDialogButtonBox>
+#include <QDoubleSpinBox>
+#include <QFileDialog>
 #include <QFormLayout>
+#include <QFutureWatcher>
+#include <QInputDialog>
 #include <QLabel>
 #include <QLineEdit>
-#include <QListWidget>
+#include <QListView>
+#include <QMessageBox>
+#include <QProgressDialog>
 #include <QPushButton>
-#include <QSpinBox>
 #include <QSvgRenderer>
 #include <QTextEdit>
+#include <QTimer>
+#include <QtConcurrentRun>
+// std
+#include <array>
+#include <cmath>
 #include <memory>
 // KF
-#include <KConfigGroup>
 #include <KLocalizedString>
-#include <KSharedConfig>
 // own
+#include "core/distribution.hpp"
+#include "core/optimiser.hpp"
+#include "core/random.hpp"
 #include "strategy/strategy.hpp"
+#include "strategy/strategyfiltermodel.hpp"
 #include "strategy/strategyinfo.hpp"
+#include "strategy/strategylistmodel.hpp"
+#include "strategy/strategyregistry.hpp"
 #include "widgets/cards.hpp"
 #include "widgets/carousel.hpp"
 
+namespace {
+/** StrategyInfo::id of the template for a new strategy. */
+constexpr qint32 template_id = -1;
+} // namespace
+
 StrategyInfo::StrategyInfo(
     QSvgRenderer* renderer, QWidget* parent, const Qt::WindowFlags flags
 )
     : QDialog(parent, flags)
+    , template_strategy(std::make_unique<Strategy>(
+          "New Strategy", "Some Notes (use Markdown)", QVector<qint32>(13),
+          true
+      ))
     , renderer(renderer)
     , id(0) {
     setWindowTitle("Strategy Info");
     setModal(true);
 
-    strategies_group
-        = new KConfigGroup(KSharedConfig::openConfig(), "CCStrategies");
-
-    init_strategies();
-
+    const Strategy* shown = StrategyRegistry::instance().get_strategy(id);
     auto* dialog_buttons = new QDialogButtonBox();
+    auto* new_button
+        = new QPushButton(QIcon::fromTheme("document-new"), i18n("&New"));
     save_button
         = new QPushButton(QIcon::fromTheme("document-save"), i18n("&Save"));
+    optimise_button = new QPushButton(
+        QIcon::fromTheme("games-solve"), i18n("&Optimise…")
+    );
+    auto* import_button = new QPushButton(
+        QIcon::fromTheme("document-import"), i18n("&Import…")
+    );
+    auto* export_button = new QPushButton(
+        QIcon::fromTheme("document-export"), i18n("&Export…")
+    );
     auto* window = new QHBoxLayout(this);
     auto* left_panel = new QWidget;
     auto* left_panel_layout = new QVBoxLayout(left_panel);
     auto* search_box = new QLineEdit();
-    list_widget = new QListWidget();
+    list_view = new QListView();
+    filter = new StrategyFilterModel(this);
+    search_timer = new QTimer(this);
     auto* right_panel = new QWidget;
     auto* body = new QVBoxLayout(right_panel);
-    auto* carousel = new Carousel(renderer->boundsOnElement("back").size());
-    name = new QLabel(items[id]->get_name());
-    description = new QLabel(items[id]->get_description());
+    carousel = new Carousel(renderer->boundsOnElement("back").size());
+    name = new QLabel(shown->get_name());
+    description = new QLabel(shown->get_description());
     name_input = new QLineEdit();
     description_input = new QTextEdit();
     auto* title = new QWidget;
     auto* title_layout = new QHBoxLayout(title);
     auto* browser = new QWidget;
     auto* browser_layout = new QHBoxLayout(browser);
+    fractions = new QComboBox();
+    evaluation = new QLabel;
+    distribution = new QLabel;
+    evaluation_timer = new QTimer(this);
 
     left_panel->setSizePolicy(QSizePolicy::Maximum, QSizePolicy::Minimum);
     search_box->setPlaceholderText(tr("Search"));
-    list_widget->setSelectionMode(QAbstractItemView::SingleSelection);
-    list_widget->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
-    list_widget->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+    filter->setSourceModel(StrategyRegistry::instance().get_model());
+    filter->sort(0);
+    list_view->setModel(filter);
+    list_view->setUniformItemSizes(true);
+    list_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    list_view->setSelectionMode(QAbstractItemView::SingleSelection);
+    list_view->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    list_view->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+    // filter once typing pauses rather than on every key
+    search_timer->setSingleShot(true);
+    search_timer->setInterval(150);
     description->setWordWrap(true);
     description->setTextFormat(Qt::TextFormat::MarkdownText);
     description->setOpenExternalLinks(true);
@@ -92,17 +137,41 @@ StrategyInfo::StrategyInfo(
     description_input->setSizePolicy(
         QSizePolicy::Expanding, QSizePolicy::Fixed
     );
+    fractions->addItem(i18n("Whole points"), 1);
+    fractions->addItem(i18n("Half points"), 2);
+    fractions->addItem(i18n("Quarter points"), 4);
+    fractions->setToolTip(i18n(
+        "Finer weights count more precisely but are harder to keep track "
+        "of at the table."
+    ));
+    fractions->setSizePolicy(QSizePolicy::Maximum, QSizePolicy::Fixed);
+    evaluation->setToolTip(i18n(
+        "Simulated over 100000 shoes of six decks dealt to 75%. Betting "
+        "correlation and insurance correlation compare the true count "
+        "with the effects of removal of the cards seen; playing "
+        "efficiency averages a few stand and double decisions."
+    ));
+    distribution->setToolTip(i18n(
+        "Exact odds of the true count, rounded down, after 75% of a "
+        "six deck shoe."
+    ));
+    evaluation_timer->setSingleShot(true);
+    evaluation_timer->setInterval(250);
     dialog_buttons->setStandardButtons(
         QDialogButtonBox::Ok | QDialogButtonBox::Cancel
     );
 
+    dialog_buttons->addButton(new_button, QDialogButtonBox::ActionRole);
     dialog_buttons->addButton(save_button, QDialogButtonBox::ActionRole);
+    dialog_buttons->addButton(optimise_button, QDialogButtonBox::ActionRole);
+    dialog_buttons->addButton(import_button, QDialogButtonBox::ActionRole);
+    dialog_buttons->addButton(export_button, QDialogButtonBox::ActionRole);
     left_panel_layout->addWidget(search_box);
     title_layout->addWidget(name_input);
     title_layout->addWidget(name);
     browser_layout->addWidget(description_input);
     browser_layout->addWidget(description);
-    left_panel_layout->addWidget(list_widget);
+    left_panel_layout->addWidget(list_view);
     window->addWidget(left_panel);
     window->addWidget(right_panel);
     body->addWidget(title);
@@ -110,55 +179,113 @@ StrategyInfo::StrategyInfo(
     for (int i = Cards::rank::Ace; i <= Cards::rank::King; i++) {
         auto* card = new Cards(renderer);
         auto* form = new QFormLayout(card);
-        auto* spin = new QSpinBox();
+        auto* spin = new QDoubleSpinBox();
 
         card->set_id(i);
-        spin->setRange(-5, 5);
-        spin->setValue(items[id]->get_weights(i - Cards::rank::Ace));
-        spin->setReadOnly(!items[id]->is_custom());
+        spin->setRange(-core::max_weight, core::max_weight);
+        spin->setDecimals(2);
+        spin->setReadOnly(!shown->is_custom());
         spin->setSizePolicy(QSizePolicy::Maximum, QSizePolicy::Maximum);
         form->setFormAlignment(Qt::AlignCenter);
         form->addRow(spin);
         carousel->add_widget(card);
+        cards.push_back(card);
         weights.push_back(spin);
+        // spin boxes change together when a strategy is shown, so wait
+        // for them to settle before evaluating
+        connect(
+            spin, &QDoubleSpinBox::valueChanged, evaluation_timer,
+            qOverload<>(&QTimer::start)
+        );
     }
     body->addWidget(carousel);
+    body->addWidget(fractions, 0, Qt::AlignHCenter);
+    body->addWidget(evaluation);
+    body->addWidget(distribution);
     body->addStretch();
     body->addWidget(dialog_buttons);
-    fill_list();
 
-    list_widget->setCurrentItem(list_widget->item(0));
+    fractions->setCurrentIndex(fractions->findData(shown->get_scale()));
+    set_scale(shown->get_scale());
+    for (int i = Cards::rank::Ace; i <= Cards::rank::King; i++) {
+        weights[i - Cards::rank::Ace]->setValue(
+            shown->get_weights(i - Cards::rank::Ace)
+            / static_cast<double>(shown->get_scale())
+        );
+    }
+    fractions->setEnabled(shown->is_custom());
+    list_view->setCurrentIndex(filter->mapFromSource(
+        StrategyRegistry::instance().get_model()->index(id)
+    ));
+    connect(
+        fractions, &QComboBox::currentIndexChanged, this,
+        [this] { set_scale(current_scale()); }
+    );
     connect(save_button, &QPushButton::clicked, this, [this] {
-        // todo: check if the name is new
-        QVector<qint32> currentWeights;
-        for (const auto& weight : weights) {
-            currentWeights.push_back(weight->value());
+        const core::Weights current = current_weights();
+        const Strategy* saved = StrategyRegistry::instance().add_custom(
+            name->text(), description->text(),
+            QVector<qint32>(current.cbegin(), current.cend()), current_scale()
+        );
+        if (saved == nullptr) {
+            // the name belongs to a built-in system
+            name_input->setFocus();
+            name_input->selectAll();
+            return;
         }
-        items[id] = new Strategy(
-            name->text(), description->text(), currentWeights, true
+        show_strategy_by_name(saved->get_name());
+    });
+    connect(new_button, &QPushButton::clicked, this, [this] {
+        show_strategy_by_name(template_strategy->get_name());
+    });
+    connect(import_button, &QPushButton::clicked, this, [this] {
+        const QString path = QFileDialog::getOpenFileName(
+            this, i18n("Import Strategies"), QString(),
+            i18n("Strategy libraries (*.csv)")
+        );
+        QString error;
+        if (!path.isEmpty()
+            && StrategyRegistry::instance().import_library(path, error) < 0) {
+            QMessageBox::warning(this, i18n("Import Strategies"), error);
+        }
+    });
+    connect(export_button, &QPushButton::clicked, this, [this] {
+        const QString path = QFileDialog::getSaveFileName(
+            this, i18n("Export Strategies"), QString(),
+            i18n("Strategy libraries (*.csv)")
         );
-        KConfigGroup strategyGroup
-            = strategies_group->group(items[id]->get_name());
-        strategyGroup.writeEntry("description", items[id]->get_description());
-        strategyGroup.writeEntry("weights", currentWeights.toList());
-        strategies_group->config()->sync();
-        list_widget->currentItem()->setText(name->text());
-        add_fake_strategy();
-        emit new_strategy();
+        QString error;
+        if (!path.isEmpty()
+            && !StrategyRegistry::instance().export_library(path, error)) {
+            QMessageBox::warning(this, i18n("Export Strategies"), error);
+        }
     });
-    connect(list_widget, &QListWidget::itemSelectionChanged, this, [this] {
-        show_strategy_by_name(list_widget->currentItem()->text());
+    connect(optimise_button, &QPushButton::clicked, this, [this] {
+        bool accepted = false;
+        const qint32 level = QInputDialog::getInt(
+            this, i18n("Optimise Strategy"),
+            i18n("Search balanced counts with weights up to:"), 2, 1, 5, 1,
+            &accepted
+        );
+        if (accepted) {
+            optimise(level);
+        }
     });
     connect(
-        search_box, &QLineEdit::textChanged, this, [this](const QString& text) {
-            for (int i = 0; i < list_widget->count(); i++) {
-                auto* item = list_widget->item(i);
-                const bool matches
-                    = item->text().contains(text, Qt::CaseInsensitive);
-                item->setHidden(!matches);
+        list_view->selectionModel(), &QItemSelectionModel::currentChanged,
+        this, [this](const QModelIndex& current) {
+            if (current.isValid()) {
+                show_strategy(filter->mapToSource(current).row());
             }
         }
     );
+    connect(
+        search_box, &QLineEdit::textChanged, search_timer,
+        qOverload<>(&QTimer::start)
+    );
+    connect(search_timer, &QTimer::timeout, this, [this, search_box] {
+        filter->set_query(search_box->text());
+    });
     connect(
         name_input, &QLineEdit::textChanged, this,
         [this](const QString& text) { name->setText(text); }
@@ -173,161 +300,266 @@ StrategyInfo::StrategyInfo(
         dialog_buttons, &QDialogButtonBox::rejected, this, &QDialog::reject
     );
 
+    connect(
+        evaluation_timer, &QTimer::timeout, this,
+        &StrategyInfo::evaluate_current
+    );
+
     save_button->hide();
     name_input->hide();
     description_input->hide();
+    evaluate_current();
 }
 
-Strategy* StrategyInfo::get_strategy_by_id(const qint32 id) {
-    return items[id];
+StrategyInfo::~StrategyInfo() {
+    for (const auto& cancel : { evaluation_cancel, optimiser_cancel }) {
+        if (cancel) {
+            *cancel = true;
+        }
+    }
 }
 
 void StrategyInfo::show_strategy_by_name(const QString& name) {
-    qint32 id = -1;
-    for (int i = 0; i < items.size(); i++) {
-        if (items[i]->get_name() == name) {
-            id = i;
-            break;
-        }
-    }
-    if (id != -1 && this->id != id) {
-        this->id = id;
-        this->name->setText(items[id]->get_name());
-        description->setText(items[id]->get_description());
-        if (id + 1 < items.size()) {
-            name_input->setText(this->name->text());
-            description_input->setText(description->text());
-        }
-        const bool is_custom = items[id]->is_custom();
-        description_input->setHidden(!is_custom);
-        name_input->setHidden(!is_custom);
-        save_button->setHidden(!is_custom);
-        for (int i = Cards::rank::Ace; i <= Cards::rank::King; i++) {
-            weights[i - Cards::rank::Ace]->setValue(
-                items[id]->get_weights(i - Cards::rank::Ace)
-            );
-            weights[i - Cards::rank::Ace]->setReadOnly(!is_custom);
+    const qint32 index = StrategyRegistry::instance().index_of(name);
+    if (index >= 0) {
+        const QModelIndex row = filter->mapFromSource(
+            StrategyRegistry::instance().get_model()->index(index)
+        );
+        if (row.isValid()) {
+            list_view->setCurrentIndex(row);
         }
+        // the row may be hidden by the search
+        show_strategy(index);
+    } else if (name == template_strategy->get_name()) {
+        list_view->setCurrentIndex({});
+        show_strategy(template_id);
     }
 }
 
-const QVector<Strategy*>& StrategyInfo::get_strategies() const { return items; }
-
-void StrategyInfo::init_strategies() {
-
-    items.push_back(new Strategy(
-        "Hi-Opt I Count",
-        "The Hi-Opt I blackjack card counting system was developed by Charles "
-        "Einstein and introduced in his book "
-        "\"The World's Greatest Blackjack Book\" in 1980. The Hi-Opt I system "
-        "assigns point values to each card in "
-        "the deck and is a more complex system than the Hi-Lo system, with "
-        "additional point values for some cards. "
-        "It is considered a more powerful system than the Hi-Lo, but also more "
-        "difficult to learn "
-        "and use effectively.",
-        { 0, 0, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1 }
-    ));
+void StrategyInfo::show_strategy(const qint32 index) {
+    const Strategy* strategy = index == template_id
+        ? template_strategy.get()
+        : StrategyRegistry::instance().get_strategy(index);
+    if (strategy == nullptr || index == id) {
+        return;
+    }
+    id = index;
+    name->setText(strategy->get_name());
+    description->setText(strategy->get_description());
+    // a new strategy starts from the texts shown last
+    if (index != template_id) {
+        name_input->setText(name->text());
+        description_input->setText(description->text());
+    }
+    const bool is_custom = strategy->is_custom();
+    description_input->setHidden(!is_custom);
+    name_input->setHidden(!is_custom);
+    save_button->setHidden(!is_custom);
+    fractions->setEnabled(is_custom);
+    {
+        // the spin boxes are rounded to the scale when it changes
+        const QSignalBlocker blocker(fractions);
+        fractions->setCurrentIndex(fractions->findData(strategy->get_scale()));
+    }
+    set_scale(strategy->get_scale());
+    for (int i = Cards::rank::Ace; i <= Cards::rank::King; i++) {
+        weights[i - Cards::rank::Ace]->setValue(
+            strategy->get_weights(i - Cards::rank::Ace)
+            / static_cast<double>(strategy->get_scale())
+        );
+        weights[i - Cards::rank::Ace]->setReadOnly(!is_custom);
+    }
+}
 
-    items.push_back(new Strategy(
-        "Hi-Lo Count",
-        "The Hi-Lo blackjack card counting system was first introduced by "
-        "Harvey Dubner in 1963. Dubner's goal was "
-        "to create a simple yet effective system that could be used by anyone "
-        "to increase their odds of winning "
-        "at blackjack.",
-        { -1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1 }
-    ));
+core::Weights StrategyInfo::current_weights() const {
+    const qint32 scale = current_scale();
+    core::Weights result {};
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = static_cast<qint32>(
+            std::lround(weights[static_cast<qsizetype>(i)]->value() * scale)
+        );
+    }
+    return result;
+}
 
-    items.push_back(new Strategy(
-        "Hi-Opt II Count",
-        "The Hi-Opt II blackjack card counting system is a more advanced "
-        "version of the Hi-Opt I system, "
-        "developed by Lance Humble and Carl Cooper in their book \"The World's "
-        "Greatest Blackjack Book\" in 1980. "
-        "The Hi-Opt II system assigns point values to each card in the deck, "
-        "with additional point values "
-        "for some cards, and is considered one of the most powerful card "
-        "counting systems. It is also one of "
-        "the most difficult to learn and use effectively.",
-        { 0, 1, 1, 2, 2, 1, 1, 0, 0, -2, -2, -2, -2 }
-    ));
+qint32 StrategyInfo::current_scale() const {
+    return fractions->currentData().toInt();
+}
 
-    items.push_back(new Strategy(
-        "KO Count",
-        "The Knock-Out (KO) blackjack card counting system was developed by "
-        "Olaf Vancura and Ken Fuchs in their "
-        "book \"Knock-Out Blackjack\" in 1998. The KO system assigns point "
-        "values to each card in the deck, with "
-        "the additional advantage that it does not require a true count "
-        "conversion for betting, making it easier "
-        "to use than some other systems.",
-        { -1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1 }
-    ));
+void StrategyInfo::set_scale(const qint32 scale) {
+    for (QDoubleSpinBox* spin : weights) {
+        spin->setSingleStep(1.0 / scale);
+        spin->setValue(std::round(spin->value() * scale) / scale);
+    }
+}
 
-    items.push_back(new Strategy(
-        "Omega II Count",
-        "The Omega II blackjack card counting system was developed by Bryce "
-        "Carlson and introduced in his book "
-        "\"Blackjack for Blood\" in 2001. The Omega II system assigns point "
-        "values to each card in the deck, with "
-        "additional point values for some cards, and is considered one of the "
-        "most powerful card counting systems, "
-        "especially for multi-deck games.",
-        { 0, 1, 1, 2, 2, 2, 1, 0, -1, -2, -2, -2, -2 }
-    ));
+void StrategyInfo::evaluate_current() {
+    const core::Weights current = current_weights();
+    show_distribution(current, current_scale());
+    if (evaluation_cancel && evaluating == current) {
+        return;
+    }
+    if (evaluation_cancel) {
+        *evaluation_cancel = true;
+        evaluation_cancel.reset();
+    }
+    core::EvaluationCache& evaluations
+        = StrategyRegistry::instance().get_evaluations();
+    if (const auto cached = evaluations.find(current)) {
+        show_evaluation(*cached);
+        return;
+    }
 
-    items.push_back(new Strategy(
-        "Zen Count",
-        "The Zen Count blackjack card counting system was developed by Arnold "
-        "Snyder and introduced in his book "
-        "\"Blackbelt in Blackjack\" in 1983. The Zen Count system assigns "
-        "point values to each card in the deck, "
-        "with additional point values for some cards, and is considered a "
-        "powerful system for both single "
-        "and multi-deck games.",
-        { -1, 1, 1, 2, 2, 2, 1, 0, 0, -2, -2, -2, -2 }
-    ));
+    evaluation->setText(i18n("Evaluating…"));
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    evaluation_cancel = cancel;
+    evaluating = current;
+    // the task only holds copies, so it can outlive the dialog
+    auto* watcher = new QFutureWatcher<std::optional<core::Evaluation>>(this);
+    connect(
+        watcher, &QFutureWatcherBase::finished, this,
+        [this, watcher, current, cancel] {
+            watcher->deleteLater();
+            const std::optional<core::Evaluation> result = watcher->result();
+            if (!result) {
+                return;
+            }
+            StrategyRegistry::instance().get_evaluations().insert(
+                current, *result
+            );
+            if (evaluation_cancel == cancel) {
+                evaluation_cancel.reset();
+                show_evaluation(*result);
+            }
+        }
+    );
+    watcher->setFuture(QtConcurrent::run([current, cancel] {
+        return core::evaluate(current, {}, cancel.get());
+    }));
+}
 
-    items.push_back(new Strategy(
-        "10 Count",
-        "The 10 Count blackjack card counting system was developed by Edward "
-        "O. Thorp, a mathematician and author "
-        "of the classic book \"Beat the Dealer\" in 1962. The 10 Count system "
-        "assigns point values to each card in "
-        "the deck, with a focus on the 10-value cards, and is considered one "
-        "of the earliest "
-        "and most basic card counting systems.",
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, -2, -2, -2, -2 }
+void StrategyInfo::show_evaluation(const core::Evaluation& result) {
+    // the correlations do not depend on the scale, the variance does
+    const qint32 scale = current_scale();
+    evaluation->setText(i18n(
+        "Betting correlation %1, playing efficiency %2, insurance "
+        "correlation %3, count variance %4",
+        QString::number(result.betting_correlation, 'f', 2),
+        QString::number(result.playing_efficiency, 'f', 2),
+        QString::number(result.insurance_correlation, 'f', 2),
+        QString::number(result.count_variance / (scale * scale), 'f', 1)
     ));
+}
 
-    // QStringList strategyNames = strategiesGroup->groupList();
-    for (const auto& strategyName : strategies_group->groupList()) {
-        KConfigGroup strategyGroup = strategies_group->group(strategyName);
-        items.push_back(new Strategy(
-            strategyName, strategyGroup.readEntry("description", ""),
-            QVector<int>::fromList(
-                strategyGroup.readEntry("weights", QList<int>())
-            ),
-            true
-        ));
+void StrategyInfo::set_renderer(QSvgRenderer* renderer) {
+    this->renderer = renderer;
+    for (Cards* card : cards) {
+        card->set_renderer(renderer);
     }
+    carousel->set_aspect_ratio(renderer->boundsOnElement("back").size());
 }
 
-void StrategyInfo::add_fake_strategy() {
-    items.push_back(new Strategy(
-        "New Strategy", "Some Notes (use Markdown)",
-        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, true
-    ));
-    list_widget->sortItems();
-    auto* widgetItem = new QListWidgetItem(items.last()->get_name());
-    list_widget->addItem(widgetItem);
+void StrategyInfo::show_distribution(
+    const core::Weights& current, const qint32 scale
+) {
+    using Odds = std::array<double, 3>;
+    // fine weights take a noticeable while, only the latest edit is shown
+    const quint64 request = ++distribution_request;
+    auto* watcher = new QFutureWatcher<Odds>(this);
+    connect(
+        watcher, &QFutureWatcherBase::finished, this,
+        [this, watcher, request] {
+            watcher->deleteLater();
+            if (request != distribution_request) {
+                return;
+            }
+            const Odds odds = watcher->result();
+            const auto percent = [&odds](const std::size_t i) {
+                return QString::number(100.0 * odds[i], 'f', 1);
+            };
+            distribution->setText(i18n(
+                "True count at 75%: +1 or more %1%, +2 or more %2%, +3 or "
+                "more %3%",
+                percent(0), percent(1), percent(2)
+            ));
+        }
+    );
+    watcher->setFuture(QtConcurrent::run([current, scale] {
+        const auto table = core::CountDistribution::get(current, 6);
+        const core::Distribution true_count
+            = table->true_count(table->at_penetration(0.75), scale);
+        return Odds { true_count.at_least(1), true_count.at_least(2),
+                      true_count.at_least(3) };
+    }));
 }
 
-void StrategyInfo::fill_list() {
-    for (const auto& item : items) {
-        auto* widgetItem = new QListWidgetItem(item->get_name());
-        list_widget->addItem(widgetItem);
-    }
-    add_fake_strategy();
+void StrategyInfo::optimise(const qint32 level) {
+    core::OptimiserParameters parameters;
+    parameters.level = level;
+    parameters.seed = core::Random::entropy();
+
+    auto* progress = new QProgressDialog(
+        i18n("Searching level %1 strategies…", level), i18n("Cancel"), 0,
+        parameters.steps, this
+    );
+    progress->setWindowModality(Qt::WindowModal);
+    progress->setMinimumDuration(0);
+    optimise_button->setEnabled(false);
+
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    optimiser_cancel = cancel;
+    using Candidates = std::vector<core::Candidate>;
+    auto* watcher = new QFutureWatcher<Candidates>(this);
+    connect(
+        watcher, &QFutureWatcherBase::progressValueChanged, progress,
+        &QProgressDialog::setValue
+    );
+    connect(progress, &QProgressDialog::canceled, this, [cancel] {
+        *cancel = true;
+    });
+    connect(
+        watcher, &QFutureWatcherBase::finished, this,
+        [this, watcher, progress, level] {
+            watcher->deleteLater();
+            progress->deleteLater();
+            optimiser_cancel.reset();
+            optimise_button->setEnabled(true);
+            // a cancelled search still hands back the best candidates so
+            // far; a closed dialog destroys the watcher before this runs
+            auto& registry = StrategyRegistry::instance();
+            for (const core::Candidate& candidate : watcher->result()) {
+                const QString name = i18n(
+                    "Level %1 (%2)", level,
+                    QString::number(candidate.score, 'f', 3)
+                );
+                if (registry.index_of(name) < 0) {
+                    registry.add_custom(
+                        name,
+                        i18n(
+                            "Found by the optimiser, betting correlation "
+                            "%1.",
+                            QString::number(candidate.score, 'f', 3)
+                        ),
+                        QVector<qint32>(
+                            candidate.weights.cbegin(),
+                            candidate.weights.cend()
+                        )
+                    );
+                }
+            }
+        }
+    );
+    // the task only holds copies, so it can outlive the dialog
+    watcher->setFuture(QtConcurrent::run(
+        [parameters, cancel](QPromise<Candidates>& promise) {
+            promise.setProgressRange(0, parameters.steps);
+            promise.addResult(core::optimise(
+                parameters,
+                [&promise](const std::int32_t step, const core::Candidate&) {
+                    promise.setProgressValue(step);
+                },
+                cancel.get()
+            ));
+        }
+    ));
 }
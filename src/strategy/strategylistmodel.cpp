@@ -0,0 +1,78 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// own
+#include "strategy/strategy.hpp"
+#include "strategy/strategylistmodel.hpp"
+#include "strategy/strategyregistry.hpp"
+
+StrategyListModel::StrategyListModel(StrategyRegistry* registry)
+    : QAbstractListModel(registry)
+    , registry(registry) {
+    connect(
+        registry, &StrategyRegistry::strategies_about_to_be_added, this,
+        [this](const qint32 first, const qint32 last) {
+            beginInsertRows({}, first, last);
+        }
+    );
+    connect(
+        registry, &StrategyRegistry::strategies_added, this,
+        &StrategyListModel::endInsertRows
+    );
+    connect(
+        registry, &StrategyRegistry::strategy_updated, this,
+        [this](const qint32 row) {
+            const QModelIndex changed = index(row);
+            emit dataChanged(changed, changed);
+        }
+    );
+}
+
+int StrategyListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid()
+        ? 0
+        : static_cast<int>(registry->get_strategies().size());
+}
+
+QVariant StrategyListModel::data(const QModelIndex& index, const int role)
+    const {
+    const Strategy* strategy = registry->get_strategy(index.row());
+    if (!index.isValid() || strategy == nullptr) {
+        return {};
+    }
+    switch (role) {
+    case Qt::DisplayRole:
+        return strategy->get_name();
+    case CustomRole:
+        return strategy->is_custom();
+    default:
+        return {};
+    }
+}
+
+QHash<int, QByteArray> StrategyListModel::roleNames() const {
+    QHash<int, QByteArray> names = QAbstractListModel::roleNames();
+    names.insert(CustomRole, "custom");
+    return names;
+}
@@ -0,0 +1,335 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Qt
+#include <QFile>
+#include <QFutureWatcher>
+#include <QJsonArray>
+#include <QtConcurrentRun>
+// std
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <optional>
+// KF
+#include <KConfigGroup>
+#include <KLocalizedString>
+#include <KSharedConfig>
+// own
+#include "configstore.hpp"
+#include "core/builtins.hpp"
+#include "strategy/strategy.hpp"
+#include "strategy/strategylistmodel.hpp"
+#include "strategy/strategyregistry.hpp"
+
+namespace {
+// descriptions of core::builtin_strategies(), in the same order
+constexpr const char* descriptions[] = {
+    "The Hi-Opt I blackjack card counting system was developed by "
+    "Charles Einstein and introduced in his book \"The World's Greatest "
+    "Blackjack Book\" in 1980. The Hi-Opt I system assigns point values "
+    "to each card in the deck and is a more complex system than the "
+    "Hi-Lo system, with additional point values for some cards. It is "
+    "considered a more powerful system than the Hi-Lo, but also more "
+    "difficult to learn and use effectively.",
+    "The Hi-Lo blackjack card counting system was first introduced by "
+    "Harvey Dubner in 1963. Dubner's goal was to create a simple yet "
+    "effective system that could be used by anyone to increase their "
+    "odds of winning at blackjack.",
+    "The Hi-Opt II blackjack card counting system is a more advanced "
+    "version of the Hi-Opt I system, developed by Lance Humble and Carl "
+    "Cooper in their book \"The World's Greatest Blackjack Book\" in "
+    "1980. The Hi-Opt II system assigns point values to each card in "
+    "the deck, with additional point values for some cards, and is "
+    "considered one of the most powerful card counting systems. It is "
+    "also one of the most difficult to learn and use effectively.",
+    "The Knock-Out (KO) blackjack card counting system was developed by "
+    "Olaf Vancura and Ken Fuchs in their book \"Knock-Out Blackjack\" "
+    "in 1998. The KO system assigns point values to each card in the "
+    "deck, with the additional advantage that it does not require a "
+    "true count conversion for betting, making it easier to use than "
+    "some other systems.",
+    "The Omega II blackjack card counting system was developed by Bryce "
+    "Carlson and introduced in his book \"Blackjack for Blood\" in "
+    "2001. The Omega II system assigns point values to each card in the "
+    "deck, with additional point values for some cards, and is "
+    "considered one of the most powerful card counting systems, "
+    "especially for multi-deck games.",
+    "The Zen Count blackjack card counting system was developed by "
+    "Arnold Snyder and introduced in his book \"Blackbelt in "
+    "Blackjack\" in 1983. The Zen Count system assigns point values to "
+    "each card in the deck, with additional point values for some "
+    "cards, and is considered a powerful system for both single and "
+    "multi-deck games.",
+    "The 10 Count blackjack card counting system was developed by "
+    "Edward O. Thorp, a mathematician and author of the classic book "
+    "\"Beat the Dealer\" in 1962. The 10 Count system assigns point "
+    "values to each card in the deck, with a focus on the 10-value "
+    "cards, and is considered one of the earliest and most basic card "
+    "counting systems.",
+    "The Wong Halves blackjack card counting system was introduced by "
+    "Stanford Wong in his book \"Professional Blackjack\" in 1975. It "
+    "counts the fives as one and a half and the twos and sevens as one "
+    "half, which makes it one of the most accurate balanced systems for "
+    "betting. The fractions make it hard to keep in one's head, so "
+    "players often double every value and halve the count again for the "
+    "true count.",
+};
+static_assert(std::size(descriptions) == core::builtin_count);
+
+/** Wrappers of the built-in systems, shared by every registry user. */
+const std::vector<Strategy>& builtins() {
+    static const std::vector<Strategy> strategies = [] {
+        std::vector<Strategy> result;
+        result.reserve(core::builtin_count);
+        for (std::size_t i = 0; i < core::builtin_count; ++i) {
+            result.emplace_back(core::builtin_strategies()[i], descriptions[i]);
+        }
+        return result;
+    }();
+    return strategies;
+}
+
+/** ConfigStore group of the custom strategies, keyed by name. */
+constexpr QLatin1String saved_strategies("strategies");
+
+QJsonObject to_json(
+    const QString& description, const QList<qint32>& weights,
+    const qint32 scale = 1
+) {
+    QJsonArray array;
+    for (const qint32 weight : weights) {
+        array.append(weight);
+    }
+    return { { QStringLiteral("description"), description },
+             { QStringLiteral("weights"), array },
+             { QStringLiteral("scale"), scale } };
+}
+} // namespace
+
+StrategyRegistry::StrategyRegistry(QObject* parent)
+    : QObject(parent) {
+    for (const Strategy& builtin : builtins()) {
+        append(&builtin);
+    }
+    ConfigStore& store = ConfigStore::instance();
+    if (!store.contains(saved_strategies)) {
+        // earlier versions kept them in the KConfig file
+        const KConfigGroup old(KSharedConfig::openConfig(), "CCStrategies");
+        for (const auto& name : old.groupList()) {
+            const KConfigGroup group = old.group(name);
+            store.set_value(
+                saved_strategies, name,
+                to_json(
+                    group.readEntry("description", ""),
+                    group.readEntry("weights", QList<qint32>())
+                )
+            );
+        }
+    }
+    const QJsonObject saved = store.group(saved_strategies);
+    for (auto it = saved.constBegin(); it != saved.constEnd(); ++it) {
+        const QJsonObject entry = it.value().toObject();
+        QVector<qint32> weights;
+        for (const QJsonValue weight : entry.value("weights").toArray()) {
+            weights.push_back(weight.toInt());
+        }
+        const qint32 scale = entry.value("scale").toInt(1);
+        custom_items.push_back(std::make_unique<Strategy>(
+            it.key(), entry.value("description").toString(), weights, true,
+            std::clamp(scale, 1, core::max_scale)
+        ));
+        append(custom_items.back().get());
+    }
+    model = new StrategyListModel(this);
+}
+
+StrategyRegistry::~StrategyRegistry() = default;
+
+StrategyRegistry& StrategyRegistry::instance() {
+    static StrategyRegistry inst;
+    return inst;
+}
+
+const QVector<const Strategy*>& StrategyRegistry::get_strategies() const {
+    return items;
+}
+
+const Strategy* StrategyRegistry::get_strategy(const qint32 index) const {
+    return index >= 0 && index < items.size() ? items[index] : nullptr;
+}
+
+qint32 StrategyRegistry::index_of(const QString& name) const {
+    return positions.value(name, -1);
+}
+
+const Strategy* StrategyRegistry::add_custom(
+    const QString& name, const QString& description,
+    const QVector<qint32>& weights, const qint32 scale
+) {
+    core::LibraryEntry entry { name.toStdString(), description.toStdString(),
+                               {}, scale };
+    std::copy_n(
+        weights.cbegin(),
+        std::min(weights.size(), qsizetype { core::rank_count }),
+        entry.weights.begin()
+    );
+    if (add_customs({ std::move(entry) }) == 0) {
+        return nullptr;
+    }
+    return items[index_of(name)];
+}
+
+qint32 StrategyRegistry::add_customs(
+    const std::vector<core::LibraryEntry>& entries
+) {
+    ConfigStore& store = ConfigStore::instance();
+    std::vector<std::unique_ptr<Strategy>> added;
+    // new in this batch, by name
+    QHash<QString, Strategy*> pending;
+    qint32 saved = 0;
+    for (const core::LibraryEntry& entry : entries) {
+        const QString name = QString::fromStdString(entry.name);
+        const qint32 index = index_of(name);
+        if (index >= 0 && !items[index]->is_custom()) {
+            continue;
+        }
+        const QList<qint32> weights(
+            entry.weights.cbegin(), entry.weights.cend()
+        );
+        Strategy strategy(
+            name, QString::fromStdString(entry.description), weights, true,
+            entry.scale
+        );
+        store.set_value(
+            saved_strategies, name,
+            to_json(strategy.get_description(), weights, entry.scale)
+        );
+        ++saved;
+        if (index >= 0) {
+            // update in place, so slots using it keep a valid pointer; the
+            // custom strategies follow the built-in ones in the same order
+            *custom_items[static_cast<std::size_t>(index) - core::builtin_count]
+                = std::move(strategy);
+            emit strategy_updated(index);
+        } else if (Strategy* known = pending.value(name)) {
+            *known = std::move(strategy);
+        } else {
+            added.push_back(std::make_unique<Strategy>(std::move(strategy)));
+            pending.insert(name, added.back().get());
+        }
+    }
+    if (!added.empty()) {
+        const auto first = static_cast<qint32>(items.size());
+        const auto last = first + static_cast<qint32>(added.size()) - 1;
+        emit strategies_about_to_be_added(first, last);
+        for (auto& strategy : added) {
+            custom_items.push_back(std::move(strategy));
+            append(custom_items.back().get());
+        }
+        emit strategies_added(first, last);
+    }
+    return saved;
+}
+
+qint32 StrategyRegistry::import_library(const QString& path, QString& error) {
+    std::ifstream input(
+        QFile::encodeName(path).toStdString(), std::ios::binary
+    );
+    if (!input) {
+        error = i18n("Cannot open %1.", path);
+        return -1;
+    }
+    std::string reason;
+    const auto entries = core::read_library(input, reason);
+    if (!entries) {
+        error = i18n(
+            "%1 is not a strategy library, %2.", path,
+            QString::fromStdString(reason)
+        );
+        return -1;
+    }
+    return add_customs(*entries);
+}
+
+bool StrategyRegistry::export_library(const QString& path, QString& error)
+    const {
+    std::ofstream output(
+        QFile::encodeName(path).toStdString(),
+        std::ios::binary | std::ios::trunc
+    );
+    core::LibraryWriter writer(output);
+    for (const auto& strategy : custom_items) {
+        writer.write({ strategy->get_name().toStdString(),
+                       strategy->get_description().toStdString(),
+                       strategy->get_counting().get_weights(),
+                       strategy->get_scale() });
+    }
+    output.flush();
+    if (!output) {
+        error = i18n("Cannot write %1.", path);
+        return false;
+    }
+    return true;
+}
+
+const core::IndexTable* StrategyRegistry::get_indices(
+    const Strategy& strategy
+) {
+    if (const core::IndexTable* shipped = strategy.get_builtin_indices()) {
+        return shipped;
+    }
+    const core::Strategy& counting = strategy.get_counting();
+    IndexKey key { counting.get_weights(), counting.get_scale() };
+    if (const auto found = indices.find(key); found != indices.end()) {
+        return &found->second;
+    }
+    if (!computing.insert(key).second) {
+        return nullptr;
+    }
+    auto* watcher = new QFutureWatcher<std::optional<core::IndexTable>>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, key] {
+        watcher->deleteLater();
+        computing.erase(key);
+        const std::optional<core::IndexTable> result = watcher->result();
+        if (!result.has_value()) {
+            // empty only if cancelled, the next get_indices() starts over
+            return;
+        }
+        indices.insert_or_assign(key, *result);
+        emit indices_computed();
+    });
+    watcher->setFuture(QtConcurrent::run([key] {
+        return core::compute_indices(key.first, key.second);
+    }));
+    return nullptr;
+}
+
+void StrategyRegistry::append(const Strategy* strategy) {
+    const QString name = strategy->get_name();
+    if (!positions.contains(name)) {
+        positions.insert(name, static_cast<qint32>(items.size()));
+    }
+    items.push_back(strategy);
+}
@@ -0,0 +1,185 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Qt
+#include <QHash>
+#include <QStringList>
+// KF
+#include <KLocalizedString>
+// own
+#include "core/blackjack.hpp"
+#include "core/library.hpp"
+#include "core/shoe.hpp"
+#include "table/slottexts.hpp"
+
+const QString& SlotTexts::weight(const qint32 value, const qint32 scale) {
+    static const KLocalizedString format = ki18n("weight: %1");
+    // by scale
+    static QHash<qint32, QVector<QString>> non_negative;
+    static QHash<qint32, QVector<QString>> negative;
+
+    QVector<QString>& texts = (value < 0 ? negative : non_negative)[scale];
+    const qint32 index = value < 0 ? -value - 1 : value;
+    if (index >= texts.size()) {
+        texts.resize(index + 1);
+    }
+    if (texts[index].isNull()) {
+        const QString points
+            = QString::fromStdString(core::format_points(value, scale));
+        texts[index] = scale == 1 ? format.subs(value).toString()
+                                  : format.subs(points).toString();
+    }
+    return texts[index];
+}
+
+const QString& SlotTexts::side_count(
+    const QString& name, const qint32 value, const qint32 scale
+) {
+    static const KLocalizedString format
+        = ki18nc("side count name and value", "%1: %2");
+    // by name and scale
+    static QHash<QPair<QString, qint32>, QVector<QString>> non_negative;
+    static QHash<QPair<QString, qint32>, QVector<QString>> negative;
+
+    QVector<QString>& texts
+        = (value < 0 ? negative : non_negative)[qMakePair(name, scale)];
+    const qint32 index = value < 0 ? -value - 1 : value;
+    if (index >= texts.size()) {
+        texts.resize(index + 1);
+    }
+    if (texts[index].isNull()) {
+        texts[index] = format.subs(name)
+                           .subs(QString::fromStdString(
+                               core::format_points(value, scale)
+                           ))
+                           .toString();
+    }
+    return texts[index];
+}
+
+QVector<QString> SlotTexts::positions(const qint32 total) {
+    static const KLocalizedString format = ki18n("%1/%2");
+    static QHash<qint32, QVector<QString>> cache;
+
+    auto it = cache.find(total);
+    if (it == cache.end()) {
+        QVector<QString> texts;
+        texts.reserve(total + 1);
+        for (qint32 position = 0; position <= total; ++position) {
+            texts.push_back(format.subs(position).subs(total).toString());
+        }
+        it = cache.insert(total, texts);
+    }
+    return it.value();
+}
+
+QVector<QString> SlotTexts::penetrations(const core::Shoe& shoe) {
+    static const KLocalizedString format = ki18nc(
+        "cards dealt, shoe size and the share of the shoe dealt", "%1/%2, %3%"
+    );
+    // by shoe size, then position, then percent
+    static QHash<qint32, QVector<QHash<qint32, QString>>> cache;
+
+    const std::vector<std::int32_t>& cards = shoe.contents();
+    const qint32 total = shoe.size();
+    qint32 standard = 0;
+    for (const std::int32_t card : cards) {
+        standard += core::is_joker(card) ? 0 : 1;
+    }
+    QVector<QHash<qint32, QString>>& by_position = cache[total];
+    by_position.resize(total + 1);
+
+    QVector<QString> texts;
+    texts.reserve(total + 1);
+    qint32 dealt = 0;
+    const auto push = [&](const qint32 position) {
+        const qint32 percent = standard ? qRound(100.0 * dealt / standard) : 0;
+        QString& text = by_position[position][percent];
+        if (text.isNull()) {
+            text = format.subs(position).subs(total).subs(percent).toString();
+        }
+        texts.push_back(text);
+    };
+    push(0);
+    for (const std::int32_t card : cards) {
+        dealt += core::is_joker(card) ? 0 : 1;
+        push(static_cast<qint32>(texts.size()));
+    }
+    return texts;
+}
+
+const QString& SlotTexts::hand(const core::Hand& hand) {
+    static const QString natural = i18nc("a two card 21", "blackjack");
+    static const QString bust = i18nc("a hand over 21", "bust");
+    static const KLocalizedString soft
+        = ki18nc("a total counting an ace as 11", "soft %1");
+    static QVector<QString> totals(core::hand_states);
+
+    if (hand.is_natural()) {
+        return natural;
+    }
+    if (hand.state == core::hand_bust) {
+        return bust;
+    }
+    QString& text = totals[hand.state];
+    if (text.isNull()) {
+        const qint32 total = core::hand_total(hand.state);
+        text = core::is_soft(hand.state) ? soft.subs(total).toString()
+                                         : QString::number(total);
+    }
+    return text;
+}
+
+QString SlotTexts::round(const core::BlackjackRound& round) {
+    static const KLocalizedString hands_format
+        = ki18nc("blackjack dealer and player hands", "dealer %1 | %2");
+    static const KLocalizedString net_format
+        = ki18nc("hands and their winnings in bets", "%1 (%2)");
+    static const QString ace = i18nc("an ace up card", "A");
+    static const QString none = QStringLiteral("-");
+
+    QStringList hands;
+    for (qint32 i = 0; i < round.get_hand_count(); ++i) {
+        const core::Hand& player = round.get_hand(i);
+        hands.push_back(player.cards ? hand(player) : none);
+    }
+    const core::Hand& dealer = round.get_dealer();
+    QString up = none;
+    if (round.is_over() || dealer.cards > 2) {
+        up = hand(dealer);
+    } else if (dealer.cards) {
+        // the hole card stays hidden until the players are done
+        up = dealer.first == 1 ? ace : QString::number(dealer.first);
+    }
+    const QString text = hands_format.subs(up)
+                             .subs(hands.join(QStringLiteral(", ")))
+                             .toString();
+    if (!round.is_over()) {
+        return text;
+    }
+    // winnings come in half bets
+    return net_format.subs(text)
+        .subs(QString::asprintf("%+g", round.get_net() / 2.0))
+        .toString();
+}
@@ -23,13 +23,13 @@
  */
 
 // Qt
-#include <QRandomGenerator>
 #include <QStandardPaths>
 #include <QSvgRenderer>
 #include <QTimer>
 #include <QVBoxLayout>
 #include <QtMath>
 // own
+#include "settings.hpp"
 #include "strategy/strategyinfo.hpp"
 #include "table/table.hpp"
 #include "table/tableslot.hpp"
@@ -42,58 +42,109 @@ Table::Table(QWidget* parent)
     layout = new QGridLayout();
     setLayout(layout);
 
+    const Settings& opts = Settings::instance();
+    engine.set_observer(this);
+    engine.set_infinite(opts.infinity_mode());
+    connect(
+        &opts, &Settings::infinity_mode_changed, this,
+        [this](const bool value) { engine.set_infinite(value); }
+    );
+    // these take effect when a shoe is refilled
+    engine.set_continuous(opts.continuous_shuffle());
+    connect(
+        &opts, &Settings::continuous_shuffle_changed, this,
+        [this](const bool value) { engine.set_continuous(value); }
+    );
+    engine.set_shuffle_delay(opts.shuffle_delay());
+    connect(
+        &opts, &Settings::shuffle_delay_changed, this,
+        [this](const int value) { engine.set_shuffle_delay(value); }
+    );
+    engine.set_round_seats(opts.blackjack_seats());
+    connect(
+        &opts, &Settings::blackjack_seats_changed, this,
+        [this](const int value) { engine.set_round_seats(value); }
+    );
+    engine.set_policy(
+        static_cast<core::SlotSampler::policy>(opts.adaptive_policy())
+    );
+    connect(
+        &opts, &Settings::adaptive_policy_changed, this,
+        [this](const int value) {
+            engine.set_policy(static_cast<core::SlotSampler::policy>(value));
+        }
+    );
+
+    connect(&opts, &Settings::changed, this, &Table::apply_settings);
+
     set_card_theme("tigullio-international");
 }
 
+void Table::apply_settings(const Settings::Changes changes) {
+    using Change = Settings::Change;
+    constexpr Settings::Changes shown_by_slots = Change::Indexing
+        | Change::ShowPenetration | Change::StrategyHint | Change::Training
+        | Change::InfinityMode;
+    if (!(changes & shown_by_slots)) {
+        return;
+    }
+    // repaint once, after every slot has laid out its new labels
+    setUpdatesEnabled(false);
+    for (const qint32 handle : engine.get_order()) {
+        views[handle]->apply_settings(changes);
+    }
+    setUpdatesEnabled(true);
+}
+
 void Table::set_speed(const int interval_ms) const {
     countdown->setInterval(interval_ms);
 }
 
 void Table::on_table_slot_activated() {
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    available.insert(layout->indexOf(table_slot));
     add_new_table_slot();
-    calculate_new_column_count(
-        size(), bounds.size(), static_cast<qint32>(items.count())
-    );
-    emit can_remove(table_slot_count_limit < available.size());
+    calculate_new_column_count(size(), bounds.size(), engine.slot_count());
+    emit can_remove(table_slot_count_limit < engine.available_count());
 }
 
 void Table::add_new_table_slot(const bool is_active) {
-    auto* table_slot = new TableSlot(strategy_info, renderer, is_active, this);
-    if (is_active) {
-        available.insert(static_cast<qint32>(items.size()));
+    const qint32 handle = engine.add_slot(is_active);
+    TableSlot* table_slot;
+    if (pool.isEmpty()) {
+        table_slot = new TableSlot(&engine, handle, renderer, this);
+        // these outlive the pooling, a pooled slot emits nothing
+        connect(
+            table_slot, &TableSlot::table_slot_activated, this,
+            &Table::on_table_slot_activated
+        );
+        connect(
+            table_slot, &TableSlot::table_slot_removed, this,
+            &Table::on_table_slot_removed
+        );
+        connect(
+            table_slot, &TableSlot::user_quizzed, this, &Table::on_user_quizzed
+        );
+        connect(
+            table_slot, &TableSlot::user_answered, this,
+            &Table::on_user_answered
+        );
+        connect(
+            table_slot, &TableSlot::swap_target_selected, this,
+            &Table::on_swap_target_selected
+        );
+        connect(
+            table_slot, &TableSlot::strategy_info_assist, this,
+            &Table::on_strategy_info_assist
+        );
+    } else {
+        table_slot = pool.takeLast();
+        // the theme may have changed while it was pooled
+        table_slot->set_renderer(renderer);
+        table_slot->reset(handle);
     }
-    connect(
-        table_slot, &TableSlot::table_slot_activated, this,
-        &Table::on_table_slot_activated
-    );
-    connect(
-        table_slot, &TableSlot::table_slot_finished, this,
-        &Table::on_table_slot_finished
-    );
-    connect(
-        table_slot, &TableSlot::table_slot_removed, this,
-        &Table::on_table_slot_removed
-    );
-    connect(
-        table_slot, &TableSlot::table_slot_reshuffled, this,
-        &Table::on_table_slot_reshuffled
-    );
-    connect(
-        table_slot, &TableSlot::user_quizzed, this, &Table::on_user_quizzed
-    );
-    connect(
-        table_slot, &TableSlot::user_answered, this, &Table::on_user_answered
-    );
-    connect(
-        table_slot, &TableSlot::swap_target_selected, this,
-        &Table::on_swap_target_selected
-    );
-    connect(
-        table_slot, &TableSlot::strategy_info_assist, this,
-        &Table::on_strategy_info_assist
-    );
+    if (handle >= views.size()) {
+        views.resize(handle + 1);
+    }
+    views[handle] = table_slot;
     connect(this, &Table::game_paused, table_slot, &TableSlot::on_game_paused);
     connect(
         this, &Table::table_slot_resized, table_slot,
@@ -105,43 +156,32 @@ void Table::add_new_table_slot(const bool is_active) {
         }
     );
     connect(this, &Table::can_remove, table_slot, &TableSlot::on_can_remove);
-    items.push_back(table_slot);
 }
 
-void Table::on_table_slot_finished() {
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    available.remove(layout->indexOf(table_slot));
-    //    qDebug() << available;
+void Table::release_table_slot(TableSlot* table_slot) {
+    const qint32 handle = table_slot->get_handle();
+    engine.remove_slot(handle);
+    swap_target.removeAll(handle);
+    views[handle] = nullptr;
+    pool_table_slot(table_slot);
 }
 
-void Table::on_table_slot_removed() {
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    items.remove(layout->indexOf(table_slot));
-    available.remove(layout->indexOf(table_slot));
-    jokers.remove(layout->indexOf(table_slot));
-    calculate_new_column_count(
-        size(), bounds.size(), static_cast<qint32>(items.count())
-    );
-    emit can_remove(available.size() > table_slot_count_limit);
+void Table::pool_table_slot(TableSlot* table_slot) {
+    disconnect(this, nullptr, table_slot, nullptr);
+    table_slot->release();
+    pool.push_back(table_slot);
 }
 
-void Table::on_table_slot_reshuffled() {
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    available.insert(layout->indexOf(table_slot));
+void Table::on_table_slot_removed() {
+    release_table_slot(qobject_cast<TableSlot*>(sender()));
+    calculate_new_column_count(size(), bounds.size(), engine.slot_count());
+    emit can_remove(engine.available_count() > table_slot_count_limit);
 }
 
-void Table::on_user_quizzed() {
-    countdown->stop();
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    jokers.insert(layout->indexOf(table_slot));
-    available.remove(layout->indexOf(table_slot));
-}
+void Table::on_user_quizzed() { countdown->stop(); }
 
 void Table::on_user_answered(const bool correct) {
-    const auto* table_slot = qobject_cast<TableSlot*>(sender());
-    jokers.remove(layout->indexOf(table_slot));
-    available.insert(layout->indexOf(table_slot));
-    if (jokers.empty()) {
+    if (!engine.has_pending_jokers()) {
         countdown->stop();
         countdown->start(countdown->interval());
     }
@@ -194,11 +234,10 @@ void Table::reorganize_table(
     );
     emit table_slot_resized(new_fixed_size.toSize());
 
-    const qint32 items_count = static_cast<qint32>(items.count());
+    const qint32 items_count = engine.slot_count();
     for (qint32 i = 0; i < items_count; i++) {
-        TableSlot* item = items[i];
+        TableSlot* item = views[engine.get_order()[static_cast<size_t>(i)]];
         layout->addWidget(item, i / new_column_count, i % new_column_count);
-        item->set_infinite_params(i, items_count);
         item->show();
     }
     column_count = new_column_count;
@@ -207,50 +246,35 @@ void Table::reorganize_table(
 }
 
 void Table::on_swap_target_selected() {
-    swap_target.push_back(layout->indexOf(qobject_cast<TableSlot*>(sender())));
+    swap_target.push_back(qobject_cast<TableSlot*>(sender())->get_handle());
     if (swap_target.size() == 2) {
-        items.swapItemsAt(swap_target[0], swap_target[1]);
+        engine.swap_slots(swap_target[0], swap_target[1]);
         swap_target.clear();
     }
     reorganize_table(column_count, scale, rotated);
 }
 
 void Table::pick_up_cards() {
-    //    qDebug() << available;
-    if (available.empty()) {
+    if (!engine.tick()) {
         countdown->stop();
         emit game_over();
-        return;
-    }
-    if (mode == card_mode::Simultaneous) {
-        for (const qint32 key : available) {
-            items[key]->pick_up_card();
-        }
-        return;
     }
+}
 
-    qint32 key;
-    if (mode == card_mode::Random) {
+void Table::card_dealt(const std::int32_t handle, const std::int32_t card) {
+    views[handle]->on_card_dealt(card);
+}
 
-        do {
-            const qint32 idx = QRandomGenerator::global()->bounded(
-                static_cast<qint32>(available.size())
-            );
-            {
-                auto it = available.begin();
-                std::advance(it, idx);
-                key = *it;
-            }
-        } while (available.size() > 1 && key == order_index);
-        order_index = key;
-    } else {
-        do {
-            key = order_index++;
-            order_index %= static_cast<qint32>(items.size());
-        } while (!available.contains(key));
-    }
+void Table::joker_dealt(const std::int32_t handle) {
+    views[handle]->on_joker_dealt();
+}
+
+void Table::shoe_finished(const std::int32_t handle) {
+    views[handle]->on_shoe_finished();
+}
 
-    items[key]->pick_up_card();
+void Table::round_finished(const std::int32_t handle) {
+    views[handle]->on_round_finished();
 }
 
 void Table::set_card_theme(const QString& theme) {
@@ -266,52 +290,35 @@ void Table::set_card_theme(const QString& theme) {
     delete renderer;
     renderer = new QSvgRenderer(path);
     bounds = renderer->boundsOnElement("back");
-    const StrategyInfo* old_strategy_info = strategy_info;
-    strategy_info = new StrategyInfo(renderer);
-    for (TableSlot* slot : items) {
-        slot->set_renderer(renderer);
-        slot->set_strategies(strategy_info);
+    for (const qint32 handle : engine.get_order()) {
+        views[handle]->set_renderer(renderer);
     }
-    delete old_strategy_info;
-    calculate_new_column_count(
-        size(), bounds.size(), static_cast<qint32>(items.count())
-    );
+    if (strategy_info) {
+        strategy_info->set_renderer(renderer);
+    }
+    calculate_new_column_count(size(), bounds.size(), engine.slot_count());
 }
 
 void Table::create_new_game(const int level) {
     countdown->stop();
     launching = true;
-    while (!items.empty()) {
-        TableSlot* last = items.last();
-        last->hide();
-        items.pop_back();
-        delete last;
+    // the engine forgets all slots at once, the widgets wait in the pool
+    for (TableSlot* view : std::as_const(views)) {
+        if (view) {
+            pool_table_slot(view);
+        }
     }
-    available.clear();
-    jokers.clear();
-    order_index = 0;
+    views.clear();
+    swap_target.clear();
+    engine.clear();
     table_slot_count_limit = 1;
-    switch (static_cast<qint32>(level)) {
-    case 1:
-        mode = card_mode::Ordered;
-        break;
-    case 3:
-        mode = card_mode::Random;
-        break;
-    case 10:
-        mode = card_mode::Simultaneous;
-        break;
-    default:
-        break;
-    }
+    set_card_mode(level);
 
     // while (items.count() < table_slot_count_limit) {
     //     add_new_table_slot(true);
     // }
     add_new_table_slot();
-    calculate_new_column_count(
-        size(), bounds.size(), static_cast<qint32>(items.count())
-    );
+    calculate_new_column_count(size(), bounds.size(), engine.slot_count());
 }
 
 bool Table::is_launching() const { return launching; }
@@ -319,13 +326,16 @@ bool Table::is_launching() const { return launching; }
 void Table::set_card_mode(const int level) {
     switch (static_cast<qint32>(level)) {
     case 1:
-        mode = card_mode::Ordered;
+        engine.set_mode(core::Engine::mode::Ordered);
         break;
     case 3:
-        mode = card_mode::Random;
+        engine.set_mode(core::Engine::mode::Random);
+        break;
+    case 5:
+        engine.set_mode(core::Engine::mode::Adaptive);
         break;
     case 10:
-        mode = card_mode::Simultaneous;
+        engine.set_mode(core::Engine::mode::Simultaneous);
         break;
     default:
         break;
@@ -334,21 +344,23 @@ void Table::set_card_mode(const int level) {
 
 void Table::pause(const bool paused) {
     if (launching && !paused) {
-        if (available.isEmpty()) {
+        if (!engine.available_count()) {
             emit game_paused(true);
             return;
         }
         launching = false;
-        if (const TableSlot* last = items.last(); last->is_fake()) {
-            items.pop_back();
-            delete last;
-            calculate_new_column_count(size(), bounds.size(), layout->count());
+        if (TableSlot* last = views[engine.get_order().back()];
+            last->is_fake()) {
+            release_table_slot(last);
+            calculate_new_column_count(
+                size(), bounds.size(), engine.slot_count()
+            );
         }
     }
     emit game_paused(paused);
     if (paused) {
         countdown->stop();
-    } else if (jokers.empty()) {
+    } else if (!engine.has_pending_jokers()) {
         countdown->stop();
         countdown->start(countdown->interval());
     }
@@ -362,9 +374,12 @@ void Table::force_game_over() {
 void Table::resizeEvent(QResizeEvent* event) {
     QWidget::resizeEvent(event);
 
-    calculate_new_column_count(
-        size(), bounds.size(), static_cast<qint32>(items.count())
-    );
+    calculate_new_column_count(size(), bounds.size(), engine.slot_count());
 }
 
-void Table::on_strategy_info_assist() const { strategy_info->show(); }
+void Table::on_strategy_info_assist() {
+    if (!strategy_info) {
+        strategy_info = new StrategyInfo(renderer, this);
+    }
+    strategy_info->show();
+}
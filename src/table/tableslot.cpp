@@ -25,89 +25,304 @@
 // Qt
 #include <QCheckBox>
 #include <QComboBox>
+#include <QDoubleSpinBox>
 #include <QFormLayout>
+#include <QHelpEvent>
+#include <QLabel>
+#include <QMenu>
 #include <QPainter>
 #include <QPropertyAnimation>
 #include <QPushButton>
 #include <QRandomGenerator>
 #include <QSpinBox>
 #include <QSvgRenderer>
+#include <QToolButton>
+#include <QToolTip>
+#include <QVBoxLayout>
 // KF
 #include <KLocalizedString>
+// std
+#include <cmath>
+#include <vector>
 // own
+#include "core/deviations.hpp"
+#include "core/engine.hpp"
 #include "settings.hpp"
 #include "strategy/strategy.hpp"
-#include "strategy/strategyinfo.hpp"
+#include "strategy/strategylistmodel.hpp"
+#include "strategy/strategyregistry.hpp"
+#include "table/slottexts.hpp"
 #include "table/tableslot.hpp"
 #include "widgets/cards.hpp"
 // own widgets
 #include "widgets/base/frame.hpp"
 #include "widgets/base/label.hpp"
 
+namespace {
+QString play_name(const core::Play play) {
+    switch (play) {
+    case core::Play::Hit:
+        return i18nc("blackjack play", "Hit");
+    case core::Play::Stand:
+        return i18nc("blackjack play", "Stand");
+    case core::Play::Double:
+        return i18nc("blackjack play", "Double");
+    case core::Play::Split:
+        return i18nc("blackjack play", "Split");
+    case core::Play::Surrender:
+        return i18nc("blackjack play", "Surrender");
+    case core::Play::Insure:
+        return i18nc("blackjack play", "Insure");
+    case core::Play::NoInsurance:
+        return i18nc("blackjack play", "No insurance");
+    }
+    return {};
+}
+
+QString card_value_name(const qint32 value) {
+    return value == 1 ? i18nc("an ace by value", "A") : QString::number(value);
+}
+
+/** The hand and up card of a deviation, such as "10, 6 against 10". */
+QString situation_text(const core::Deviation& deviation) {
+    const QString up = card_value_name(deviation.up);
+    if (deviation.is_insurance()) {
+        return i18nc("dealer up card offering insurance", "Insurance, %1:", up);
+    }
+    return i18nc(
+        "two player cards against the dealer up card", "%1, %2 against %3:",
+        card_value_name(deviation.first), card_value_name(deviation.second), up
+    );
+}
+} // namespace
+
 TableSlot::TableSlot(
-    StrategyInfo* strategies, QSvgRenderer* renderer, const bool is_active,
+    core::Engine* engine, const qint32 handle, QSvgRenderer* renderer,
     QWidget* parent
 )
     : Cards(renderer, parent)
     , highlight_opacity(0.0)
-    , strategies(strategies) {
+    , engine(engine)
+    , handle(handle) {
     highlight_anim = new QPropertyAnimation(this, "highlight_opacity", this);
     highlight_anim->setDuration(500);
+    highlight_anim->setStartValue(1.0);
+    highlight_anim->setEndValue(0.0);
 
     // QLabels:
     message_label = new CCLabel(i18n("TableSlot Weight: 0"));
     index_label = new CCLabel("0/0");
-    weight_label = new CCLabel("weight: 0");
+    weight_label = new CCLabel(SlotTexts::weight(0));
+    weight_label->installEventFilter(this);
     strategy_hint_label = new CCLabel("");
-    on_strategy_changed(0);
+    round_label = new CCLabel("");
 
     // QComboBoxes:
     strategy_box = new QComboBox();
-    on_new_strategy();
-    connect(
-        strategies, &StrategyInfo::new_strategy, this,
-        &TableSlot::on_new_strategy
-    );
+    // the model is shared by all slots and keeps the selection on inserts
+    strategy_box->setModel(StrategyRegistry::instance().get_model());
     connect(
         strategy_box, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
         &TableSlot::on_strategy_changed
     );
-    Settings& opts = Settings::instance();
+
+    // QFrames, the answer and control frames are built when first shown:
+    settings_frame = new CCFrame();
+
+    // QSpinBoxes:
+    deck_count = new QSpinBox();
+    connect(
+        deck_count, QOverload<int>::of(&QSpinBox::valueChanged), this,
+        &TableSlot::activate
+    );
+    deck_count->setRange(0, 10);
+
+    // QPushButtons:
+    auto* strategy_info_button
+        = new QPushButton(QIcon::fromTheme("kt-info-widget"), i18n("&Info"));
+    strategy_info_button->setSizePolicy(
+        QSizePolicy::Maximum, QSizePolicy::Maximum
+    );
+    connect(
+        strategy_info_button, &QPushButton::clicked, this,
+        &TableSlot::strategy_info_assist
+    );
+
+    // QToolButtons:
+    side_button = new QToolButton();
+    side_button->setPopupMode(QToolButton::InstantPopup);
+    side_button->setMenu(new QMenu(side_button));
+    side_button->setToolTip(i18n(
+        "Counts kept next to the main one, such as an ace side count. A "
+        "joker asks for any of them."
+    ));
+    connect(
+        side_button->menu(), &QMenu::aboutToShow, this,
+        &TableSlot::fill_side_menu
+    );
+
+    // QFormLayouts:
+    auto* settings = new QFormLayout(settings_frame);
+    settings->setFormAlignment(Qt::AlignCenter);
+
+    // Other Layouts:
+    auto* box_layout = new QVBoxLayout(this);
+    auto* info_layout = new QHBoxLayout();
+    auto* strategy_layout = new QHBoxLayout();
+    frame_layout = new QVBoxLayout();
+
+    strategy_layout->addWidget(strategy_box);
+    strategy_layout->addWidget(strategy_info_button);
+
+    count_layout = new QHBoxLayout();
+    count_layout->addWidget(weight_label);
+    info_layout->addLayout(count_layout);
+    info_layout->addStretch();
+    info_layout->addWidget(index_label);
+
+    settings->addRow(tr("&Number of Card Decks:"), deck_count);
+    settings->addRow(tr("Type of Strategy:"), strategy_layout);
+    settings->addRow(tr("Side Counts:"), side_button);
+
+    frame_layout->addWidget(settings_frame);
+
+    box_layout->addWidget(strategy_hint_label);
+    box_layout->addStretch();
+    box_layout->addWidget(message_label);
+    box_layout->addLayout(frame_layout);
+    box_layout->addStretch();
+    box_layout->addWidget(round_label);
+    box_layout->addLayout(info_layout);
+
+    reset(handle);
+}
+
+void TableSlot::reset(const qint32 handle) {
+    this->handle = handle;
+    highlight_anim->stop();
+    highlight_opacity = 0.0;
+    set_id(-1);
+    set_name("back");
+    position_texts.clear();
+    asking_true_count = false;
+    deviation_indices = nullptr;
+    awaiting_indices = false;
+
+    const Settings& opts = Settings::instance();
+    message_label->hide();
+    message_label->setPalette(QPalette(Qt::gray));
+    index_label->setText("0/0");
     index_label->setVisible(opts.indexing());
     strategy_hint_label->setVisible(opts.strategy_hint());
     weight_label->setVisible(opts.training());
+    // rounds start with the next shoe, the label shows up with them
+    round_label->hide();
     connect(
-        &opts, &Settings::indexing_changed, index_label, &CCLabel::setVisible
+        StrategyRegistry::instance().get_model(),
+        &QAbstractItemModel::dataChanged, this,
+        [this](const QModelIndex& top_left, const QModelIndex& bottom_right) {
+            // the chosen strategy may have been saved with new weights
+            const int current = strategy_box->currentIndex();
+            if (top_left.row() <= current && current <= bottom_right.row()) {
+                on_strategy_changed(current);
+            }
+            const StrategyRegistry& registry = StrategyRegistry::instance();
+            for (const Strategy* side : std::as_const(side_counts)) {
+                const qint32 row = registry.index_of(side->get_name());
+                if (top_left.row() <= row && row <= bottom_right.row()) {
+                    apply_side_counts();
+                    break;
+                }
+            }
+        }
     );
+
     connect(
-        &opts, &Settings::strategy_hint_changed, strategy_hint_label,
-        &CCLabel::setVisible
+        &StrategyRegistry::instance(), &StrategyRegistry::indices_computed,
+        this, [this] {
+            // an open count quiz stays as it is, the user may be typing;
+            // the next joker finds the indices in the registry
+            if (awaiting_indices
+                && StrategyRegistry::instance().get_indices(
+                    *quizzed_strategy()
+                )) {
+                awaiting_indices = false;
+            }
+        }
     );
-    connect(
-        &opts, &Settings::training_changed, weight_label, &CCLabel::setVisible
+
+    // blocked while pooled, the engine learns the strategy right after
+    strategy_box->blockSignals(true);
+    strategy_box->setCurrentIndex(0);
+    strategy_box->blockSignals(false);
+    on_strategy_changed(0);
+    side_counts.clear();
+    apply_side_counts();
+
+    if (answer_frame) {
+        answer_frame->hide();
+    }
+    if (control_frame) {
+        control_frame->hide();
+        refresh_button->hide();
+    }
+    removable = false;
+    settings_frame->show();
+    deck_count->setVisible(!opts.infinity_mode());
+    deck_count->setMinimum(0);
+    deck_count->setValue(0);
+    if (!is_fake()) {
+        deck_count->setValue(1);
+    }
+    update();
+}
+
+void TableSlot::release() {
+    // a pooled slot must not reach the engine under its old handle
+    disconnect(
+        StrategyRegistry::instance().get_model(), nullptr, this, nullptr
     );
+    disconnect(&StrategyRegistry::instance(), nullptr, this, nullptr);
+    strategy_box->blockSignals(true);
+    hide();
+}
+
+void TableSlot::apply_settings(const Settings::Changes changes) {
+    using Change = Settings::Change;
+    const Settings& opts = Settings::instance();
+    // hidden labels are not kept up to date while dealing, catch up first
+    if (changes & (Change::Indexing | Change::ShowPenetration)) {
+        index_label->setVisible(opts.indexing());
+        fill_position_texts();
+        refresh_index_label();
+    }
+    if (changes & Change::StrategyHint) {
+        strategy_hint_label->setVisible(opts.strategy_hint());
+    }
+    if (changes & Change::Training) {
+        weight_label->setVisible(opts.training());
+        fit_side_labels();
+        refresh_weight_label();
+    }
+    if (changes & Change::InfinityMode) {
+        deck_count->setVisible(!opts.infinity_mode());
+    }
+}
 
-    // QFrames:
+CCFrame* TableSlot::get_answer_frame() {
+    if (answer_frame) {
+        return answer_frame;
+    }
     answer_frame = new CCFrame();
-    settings_frame = new CCFrame();
-    settings_frame->show();
-    control_frame = new CCFrame();
 
     // QSpinBoxes:
-    weight_box = new QSpinBox();
+    weight_box = new QDoubleSpinBox();
     weight_box->setRange(-100, 100);
+    quiz_label = new QLabel(tr("&Weight:"));
+    quiz_label->setBuddy(weight_box);
 
-    deck_count = new QSpinBox();
-    connect(
-        deck_count, QOverload<int>::of(&QSpinBox::valueChanged), this,
-        &TableSlot::activate
-    );
-    deck_count->setRange(is_active, 10);
-    deck_count->setVisible(!opts.infinity_mode());
-    connect(
-        &opts, &Settings::infinity_mode_changed, deck_count,
-        &QWidget::setVisible
-    );
+    play_box = new QComboBox();
+    play_box->hide();
 
     // QPushButtons:
     auto* submit_button
@@ -124,23 +339,34 @@ TableSlot::TableSlot(
     // todo:    connect(skipButton, &QPushButton::clicked, this,
     // &TableSlot::skipping);
 
-    auto* strategy_info_button
-        = new QPushButton(QIcon::fromTheme("kt-info-widget"), i18n("&Info"));
-    strategy_info_button->setSizePolicy(
-        QSizePolicy::Maximum, QSizePolicy::Maximum
-    );
-    connect(
-        strategy_info_button, &QPushButton::clicked, this,
-        &TableSlot::strategy_info_assist
-    );
+    // Layouts:
+    auto* answer = new QFormLayout(answer_frame);
+    answer->setFormAlignment(Qt::AlignCenter);
+    auto* answer_layout = new QHBoxLayout();
+    answer_layout->addWidget(weight_box);
+    answer_layout->addWidget(play_box);
+    answer->addRow(quiz_label, answer_layout);
+    answer->addRow(submit_button, skip_button);
+
+    // above the settings and control frames
+    frame_layout->insertWidget(0, answer_frame);
+    return answer_frame;
+}
 
+CCFrame* TableSlot::get_control_frame() {
+    if (control_frame) {
+        return control_frame;
+    }
+    control_frame = new CCFrame();
+
+    // QPushButtons:
     close_button = new QPushButton(QIcon::fromTheme("delete"), i18n("&Remove"));
     close_button->setSizePolicy(QSizePolicy::Maximum, QSizePolicy::Maximum);
     connect(
         close_button, &QPushButton::clicked, this,
         &TableSlot::table_slot_removed
     );
-    close_button->hide();
+    close_button->setVisible(removable);
 
     refresh_button
         = new QPushButton(QIcon::fromTheme("view-refresh"), i18n("&Reshuffle"));
@@ -159,63 +385,35 @@ TableSlot::TableSlot(
         &TableSlot::swap_target_selected
     );
 
-    // QFormLayouts:
-    auto* settings = new QFormLayout(settings_frame);
-    settings->setFormAlignment(Qt::AlignCenter);
-    auto* answer = new QFormLayout(answer_frame);
-    answer->setFormAlignment(Qt::AlignCenter);
-
-    // Other Layouts:
-    auto* box_layout = new QVBoxLayout(this);
-    auto* info_layout = new QHBoxLayout();
+    // Layouts:
     auto* control_layout = new QHBoxLayout(control_frame);
-    auto* strategy_layout = new QHBoxLayout();
-
-    strategy_layout->addWidget(strategy_box);
-    strategy_layout->addWidget(strategy_info_button);
-
-    info_layout->addWidget(weight_label);
-    info_layout->addStretch();
-    info_layout->addWidget(index_label);
-
-    answer->addRow(tr("&Weight:"), weight_box);
-    answer->addRow(submit_button, skip_button);
-
-    settings->addRow(tr("&Number of Card Decks:"), deck_count);
-    settings->addRow(tr("Type of Strategy:"), strategy_layout);
-
     control_layout->addWidget(close_button);
     control_layout->addWidget(refresh_button);
     control_layout->addWidget(swap_button);
 
-    box_layout->addWidget(strategy_hint_label);
-    box_layout->addStretch();
-    box_layout->addWidget(message_label);
-    box_layout->addWidget(answer_frame);
-    box_layout->addWidget(settings_frame);
-    box_layout->addWidget(control_frame);
-    box_layout->addStretch();
-    box_layout->addLayout(info_layout);
+    frame_layout->addWidget(control_frame);
+    return control_frame;
 }
 
 void TableSlot::on_game_paused(const bool paused) {
     if (!settings_frame->isHidden()) {
-        if (Settings::instance().infinity_mode()) {
-            cards.clear();
-        } else {
-            cards = shuffle_cards(deck_count->value());
-        }
+        refill_shoe();
+        get_control_frame();
         refresh_button->show();
         //        swapButton->hide();
         set_id(-1);
         settings_frame->hide();
     }
     if (paused) {
-        answer_frame->hide();
+        if (answer_frame) {
+            answer_frame->hide();
+        }
         set_name("blue_back");
-        control_frame->show();
+        get_control_frame()->show();
     } else {
-        control_frame->hide();
+        if (control_frame) {
+            control_frame->hide();
+        }
         if (is_joker()) {
             set_name(get_card_name_by_current_id());
             user_quizzing();
@@ -224,161 +422,334 @@ void TableSlot::on_game_paused(const bool paused) {
     update();
 }
 
-bool TableSlot::is_fake() const { return fake; }
-
-void TableSlot::pick_up_card() {
-    const Settings& opts = Settings::instance();
-    if (opts.infinity_mode()) {
-        qint32 last_id = get_current_id();
-        double k = 1.0 + static_cast<double>(slot_idx + 1) / total_slots;
-        auto* rng = QRandomGenerator::global();
-        qint32 new_card;
-        if (rng->bounded(54) == 0) {
-            qint32 colour = rng->bounded(2) ? Red : Black;
-            new_card = (colour & 0xff) << 8;
-        } else {
-            int suit;
-            int rank;
-            bool have_last = last_id >= 0 && !Cards::is_joker(last_id);
-            if (have_last && rng->generateDouble() < 1.0 / (4.0 * k)) {
-                suit = Cards::get_suit(last_id);
-            } else {
-                QVector<int> suits;
-                for (int s = Clubs; s <= Spades; ++s) {
-                    if (!have_last || s != Cards::get_suit(last_id))
-                        suits.append(s);
-                }
-                suit = suits[rng->bounded(suits.size())];
-            }
+bool TableSlot::is_fake() const { return engine->is_fake(handle); }
 
-            if (have_last && rng->generateDouble() < 1.0 / (13.0 * k)) {
-                rank = Cards::get_rank(last_id);
-            } else {
-                QVector<int> ranks;
-                for (int r = Ace; r <= King; ++r) {
-                    if (!have_last || r != Cards::get_rank(last_id))
-                        ranks.append(r);
-                }
-                rank = ranks[rng->bounded(ranks.size())];
-            }
-            new_card = ((suit & 0xff) << 8) | (rank & 0xff);
-        }
-        set_id(new_card);
-    } else {
-        if (cards.empty()) {
-            set_name("back");
-            emit table_slot_finished();
-            settings_frame->show();
-            control_frame->show();
-            update();
-            return;
-        }
-        //    if (isJoker()){
-        //        messageLabel->hide();
-        //    }
-        set_id(cards.front());
-        set_name(get_card_name_by_current_id());
-        cards.pop_front();
-    }
+void TableSlot::on_card_dealt(const qint32 card) {
+    set_id(card);
     if (!message_label->isHidden()) {
         message_label->hide();
     }
     update();
-    if (!opts.infinity_mode()) {
-        index_label->setText(i18n(
-            "%1/%2", deck_count->value() * 54 - cards.size(),
-            deck_count->value() * 54
-        ));
+    if (!engine->is_infinite()) {
+        refresh_index_label();
+    }
+    if (!is_joker()) {
+        refresh_weight_label();
     }
-    if (is_joker()) {
-        user_quizzing();
+    if (isVisible()) {
+        start_highlight();
+    }
+}
+
+void TableSlot::on_joker_dealt() {
+    // a true count needs a shoe to divide by, which a machine does not have
+    const int type = Settings::instance().quiz_type();
+    const bool has_shoe
+        = !engine->is_infinite() && engine->get_shoe(handle).size() > 0;
+    deviation_indices = nullptr;
+    if (type == Settings::Deviation && has_shoe) {
+        // until the indices of a custom strategy are simulated, the joker
+        // asks for its count instead
+        deviation_indices = StrategyRegistry::instance().get_indices(
+            *quizzed_strategy()
+        );
+        deviation = QRandomGenerator::global()->bounded(
+            static_cast<quint32>(core::deviation_count)
+        );
+    }
+    awaiting_indices
+        = type == Settings::Deviation && has_shoe && !deviation_indices;
+    asking_true_count = has_shoe
+        && (type == Settings::TrueCount
+            || (type == Settings::EitherCount
+                && QRandomGenerator::global()->bounded(2)));
+    user_quizzing();
+}
+
+void TableSlot::on_round_finished() { refresh_round_label(); }
+
+void TableSlot::on_shoe_finished() {
+    set_name("back");
+    emit table_slot_finished();
+    settings_frame->show();
+    get_control_frame()->show();
+    update();
+}
+
+void TableSlot::refill_shoe() {
+    engine->set_deck_count(handle, deck_count->value());
+    engine->reshuffle(handle);
+    fill_position_texts();
+    refresh_index_label();
+    round_label->setVisible(engine->get_round(handle).get_seats() > 0);
+    refresh_round_label();
+}
+
+void TableSlot::fill_position_texts() {
+    const core::Shoe& shoe = engine->get_shoe(handle);
+    if (engine->is_infinite() || engine->is_continuous() || !shoe.size()) {
+        position_texts.clear();
+    } else if (Settings::instance().show_penetration()) {
+        position_texts = SlotTexts::penetrations(shoe);
     } else {
-        current_weight
-            = strategy->update_weight(current_weight, get_current_rank());
-        weight_label->setText(i18n("weight: %1", current_weight));
+        position_texts = SlotTexts::positions(shoe.size());
+    }
+}
+
+void TableSlot::refresh_index_label() const {
+    if (index_label->isHidden() || position_texts.isEmpty()) {
+        return;
     }
-    start_highlight();
+    const core::Shoe& shoe = engine->get_shoe(handle);
+    index_label->setText(
+        position_texts.at(position_texts.size() - 1 - shoe.remaining())
+    );
+}
+
+void TableSlot::refresh_weight_label() const {
+    if (weight_label->isHidden()) {
+        return;
+    }
+    weight_label->setText(SlotTexts::weight(
+        engine->get_running_count(handle), strategy->get_scale()
+    ));
+    for (qint32 i = 0; i < side_counts.size(); ++i) {
+        side_labels[i]->setText(SlotTexts::side_count(
+            side_counts[i]->get_name(),
+            engine->get_running_count(handle, i + 1),
+            side_counts[i]->get_scale()
+        ));
+    }
+}
+
+void TableSlot::fit_side_labels() {
+    while (side_labels.size() < side_counts.size()) {
+        auto* label = new CCLabel("");
+        count_layout->addWidget(label);
+        side_labels.push_back(label);
+    }
+    const bool training = Settings::instance().training();
+    for (qint32 i = 0; i < side_labels.size(); ++i) {
+        side_labels[i]->setVisible(training && i < side_counts.size());
+    }
+}
+
+void TableSlot::refresh_round_label() const {
+    if (round_label->isHidden()) {
+        return;
+    }
+    round_label->setText(SlotTexts::round(engine->get_round(handle)));
 }
 
 void TableSlot::user_quizzing() {
+    get_answer_frame();
+    weight_box->setVisible(deviation_indices == nullptr);
+    play_box->setVisible(deviation_indices != nullptr);
+    if (deviation_indices) {
+        const core::Deviation& situation = core::deviations[deviation];
+        quiz_label->setText(situation_text(situation));
+        quiz_label->setBuddy(play_box);
+        play_box->clear();
+        std::vector<core::Play> plays { core::Play::Hit, core::Play::Stand,
+                                        core::Play::Double };
+        if (situation.is_insurance()) {
+            plays = { core::Play::Insure, core::Play::NoInsurance };
+        } else if (situation.first == situation.second) {
+            plays.push_back(core::Play::Split);
+        } else if (situation.above == core::Play::Surrender) {
+            plays.push_back(core::Play::Surrender);
+        }
+        for (const core::Play play : plays) {
+            play_box->addItem(play_name(play), static_cast<int>(play));
+        }
+        answer_frame->show();
+        emit user_quizzed();
+        return;
+    }
+    quiz_label->setBuddy(weight_box);
+    const Strategy* asked = quizzed_strategy();
+    const bool main = engine->get_quizzed_counter(handle) == 0;
+    if (asking_true_count) {
+        quiz_label->setText(
+            main ? i18n("&True count:")
+                 : i18nc(
+                       "side count asked for", "%1 true count:",
+                       asked->get_name()
+                   )
+        );
+    } else {
+        quiz_label->setText(
+            main ? tr("&Weight:")
+                 : i18nc("side count asked for", "%1:", asked->get_name())
+        );
+    }
+    // answers are typed in points, e.g. 1.5 for Halves, true counts whole
+    const qint32 scale = asking_true_count ? 1 : asked->get_scale();
+    weight_box->setDecimals(scale == 1 ? 0 : scale == 2 ? 1 : 2);
+    weight_box->setSingleStep(1.0 / scale);
     answer_frame->show();
     emit user_quizzed();
 }
 
+const Strategy* TableSlot::quizzed_strategy() const {
+    const qint32 counter = engine->get_quizzed_counter(handle);
+    return counter == 0 ? strategy : side_counts.value(counter - 1, strategy);
+}
+
+void TableSlot::apply_side_counts() {
+    std::vector<core::Strategy> counting;
+    counting.reserve(static_cast<std::size_t>(side_counts.size()));
+    for (const Strategy* side : std::as_const(side_counts)) {
+        counting.push_back(side->get_counting());
+    }
+    engine->set_side_counts(handle, counting);
+    side_button->setText(
+        side_counts.isEmpty()
+            ? i18n("None")
+            : i18np("%1 side count", "%1 side counts", side_counts.size())
+    );
+    fit_side_labels();
+    refresh_weight_label();
+}
+
+void TableSlot::set_side_counts(const QVector<const Strategy*>& strategies) {
+    side_counts = strategies.mid(0, core::CounterSet::max_counters - 1);
+    apply_side_counts();
+}
+
+void TableSlot::fill_side_menu() {
+    QMenu* menu = side_button->menu();
+    menu->clear();
+    const bool full = side_counts.size() + 1 >= core::CounterSet::max_counters;
+    for (const Strategy* candidate :
+         StrategyRegistry::instance().get_strategies()) {
+        QAction* action = menu->addAction(candidate->get_name());
+        const bool chosen = side_counts.contains(candidate);
+        action->setCheckable(true);
+        action->setChecked(chosen);
+        action->setEnabled(chosen || !full);
+        connect(action, &QAction::toggled, this, [this, candidate](bool on) {
+            if (on) {
+                side_counts.push_back(candidate);
+            } else {
+                side_counts.removeOne(candidate);
+            }
+            apply_side_counts();
+        });
+    }
+}
+
 void TableSlot::user_checking() {
-    message_label->setText(i18n("TableSlot Weight: %1", current_weight));
+    const qint32 counter = engine->get_quizzed_counter(handle);
+    const Strategy* asked = quizzed_strategy();
+    const QString count
+        = asked->format_count(engine->get_running_count(handle, counter));
+    QString text = counter == 0
+        ? i18n("TableSlot Weight: %1", count)
+        : i18nc(
+              "side count name and value", "%1: %2", asked->get_name(), count
+          );
+    const auto rounding = static_cast<core::Rounding>(
+        Settings::instance().true_count_rounding()
+    );
+    bool is_correct;
+    if (deviation_indices) {
+        const core::Deviation& situation = core::deviations[deviation];
+        const std::int8_t index = (*deviation_indices)[deviation];
+        const qint32 true_count = core::round_true_count(
+            engine->get_true_count(handle, counter), rounding
+        );
+        text += i18nc(
+            "right play, the true count and the index of the deviation",
+            ", %1 at true count %2 (index %3)",
+            play_name(core::play_at(situation, index, true_count)),
+            true_count, qint32 { index }
+        );
+        is_correct = engine->answer_play(
+            handle, situation, index,
+            static_cast<core::Play>(play_box->currentData().toInt()), rounding
+        );
+    } else if (asking_true_count) {
+        const double exact = engine->get_true_count(handle, counter);
+        text += i18nc(
+            "rounded and exact true count", ", true count %1 (%2)",
+            core::round_true_count(exact, rounding),
+            QString::number(exact, 'f', 2)
+        );
+        is_correct = engine->answer_true_count(
+            handle, static_cast<qint32>(std::lround(weight_box->value())),
+            rounding
+        );
+    } else {
+        is_correct = engine->answer(
+            handle,
+            static_cast<qint32>(
+                std::lround(weight_box->value() * asked->get_scale())
+            )
+        );
+    }
+    message_label->setText(text);
     answer_frame->hide();
-    const bool is_correct = weight_box->value() == current_weight;
     message_label->setPalette(QPalette(is_correct ? Qt::green : Qt::red));
     message_label->show();
     emit user_answered(is_correct);
 }
 
 void TableSlot::reshuffle_deck() {
-    if (Settings::instance().infinity_mode()) {
-        cards.clear();
-    } else {
-        cards = shuffle_cards(deck_count->value());
-    }
+    refill_shoe();
     settings_frame->hide();
     // hide controlFrame if not paused
 }
 
-void TableSlot::on_can_remove(const bool can_remove) const {
-    close_button->setVisible(can_remove);
+void TableSlot::on_can_remove(const bool can_remove) {
+    removable = can_remove;
+    if (close_button) {
+        close_button->setVisible(can_remove);
+    }
 }
 
 void TableSlot::activate(const int value) {
-    if (value > 0 && fake) {
-        fake = false;
-        control_frame->show();
+    if (value > 0 && deck_count->minimum() == 0) {
+        engine->activate(handle);
+        get_control_frame()->show();
         set_name("green_back");
-        current_weight = 0;
+        refresh_weight_label();
         deck_count->setMinimum(1);
         emit table_slot_activated();
     }
 }
 
-void TableSlot::set_infinite_params(const int idx, const int total) {
-    slot_idx = idx;
-    total_slots = total > 0 ? total : 1;
-}
-
-void TableSlot::set_strategies(StrategyInfo* info) {
-    if (strategies == info) {
-        return;
-    }
-    if (strategies) {
-        disconnect(
-            strategies, &StrategyInfo::new_strategy, this,
-            &TableSlot::on_new_strategy
-        );
-    }
-    strategies = info;
-    if (strategies) {
-        connect(
-            strategies, &StrategyInfo::new_strategy, this,
-            &TableSlot::on_new_strategy
-        );
-        on_new_strategy();
+void TableSlot::on_strategy_changed(const int index) {
+    if (index >= 0) {
+        strategy = StrategyRegistry::instance().get_strategy(index);
+        strategy_hint_label->setText(strategy->get_name());
+        // the engine recounts the cards dealt so far under the new weights
+        engine->set_strategy(handle, strategy->get_counting());
+        refresh_weight_label();
     }
 }
 
-void TableSlot::on_new_strategy() const {
-    QStringList items;
-    for (const auto& item : strategies->get_strategies()) {
-        items.push_back(item->get_name());
+bool TableSlot::eventFilter(QObject* watched, QEvent* event) {
+    if (watched != weight_label || event->type() != QEvent::ToolTip) {
+        return Cards::eventFilter(watched, event);
     }
-    items.pop_back(); // last is fake
-    strategy_box->clear();
-    strategy_box->addItems(items);
-}
-
-void TableSlot::on_strategy_changed(const int index) {
-    if (index >= 0) {
-        strategy = strategies->get_strategy_by_id(index);
-        strategy_hint_label->setText(strategy->get_name());
+    // built on demand from the dealt ranks, whatever the depth of the shoe
+    QStringList lines;
+    const StrategyRegistry& registry = StrategyRegistry::instance();
+    for (const Strategy* other : registry.get_strategies()) {
+        lines.push_back(i18nc(
+            "strategy name and the count it would have", "%1: %2",
+            other->get_name(),
+            other->format_count(
+                engine->count_with(handle, other->get_counting())
+            )
+        ));
     }
+    QToolTip::showText(
+        static_cast<QHelpEvent*>(event)->globalPos(),
+        lines.join(QLatin1Char('\n')), weight_label
+    );
+    return true;
 }
 
 void TableSlot::paintEvent(QPaintEvent* event) {
@@ -406,9 +777,11 @@ void TableSlot::set_highlight_opacity(const float value) {
 float TableSlot::get_highlight_opacity() const { return highlight_opacity; }
 
 void TableSlot::start_highlight() {
-    highlight_anim->stop();
     set_highlight_opacity(1.0);
-    highlight_anim->setStartValue(1.0);
-    highlight_anim->setEndValue(0.0);
-    highlight_anim->start();
+    // rewinding a running fade keeps it registered with the animation timer
+    if (highlight_anim->state() == QAbstractAnimation::Running) {
+        highlight_anim->setCurrentTime(0);
+    } else {
+        highlight_anim->start();
+    }
 }
@@ -0,0 +1,112 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+// own
+#include "core/builtins.hpp"
+#include "core/library.hpp"
+#include "tools/arguments.hpp"
+
+namespace tools {
+
+namespace {
+bool equals_ignoring_case(std::string_view left, std::string_view right) {
+    const auto same = [](const char a, const char b) {
+        return std::tolower(static_cast<unsigned char>(a))
+            == std::tolower(static_cast<unsigned char>(b));
+    };
+    return left.size() == right.size()
+        && std::equal(left.begin(), left.end(), right.begin(), same);
+}
+} // namespace
+
+bool parse_integer(const char* text, std::int64_t& value) {
+    char* end = nullptr;
+    value = std::strtoll(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+bool parse_number(const char* text, double& value) {
+    char* end = nullptr;
+    value = std::strtod(text, &end);
+    return end != text && *end == '\0';
+}
+
+bool parse_strategy(const char* text, std::size_t& index) {
+    std::int64_t number;
+    if (parse_integer(text, number)) {
+        if (number < 0 || number >= std::int64_t(core::builtin_count)) {
+            return false;
+        }
+        index = static_cast<std::size_t>(number);
+        return true;
+    }
+    const std::string_view name(text);
+    for (std::size_t i = 0; i < core::builtin_count; ++i) {
+        std::string_view candidate = core::builtin_strategies()[i].name;
+        if (equals_ignoring_case(candidate, name)
+            || equals_ignoring_case(
+                candidate.substr(0, candidate.rfind(" Count")), name
+            )) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_weights(
+    const char* text, core::Weights& weights, std::int32_t& scale
+) {
+    std::array<std::string_view, core::rank_count> fields;
+    std::string_view rest(text);
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        const std::size_t comma = rest.find(',');
+        if ((comma == std::string_view::npos) != (i + 1 == fields.size())) {
+            return false;
+        }
+        fields[i] = rest.substr(0, comma);
+        rest.remove_prefix(
+            comma == std::string_view::npos ? rest.size() : comma + 1
+        );
+    }
+    return core::parse_points(fields, weights, scale);
+}
+
+void print_strategies() {
+    for (std::size_t i = 0; i < core::builtin_count; ++i) {
+        const std::string_view name = core::builtin_strategies()[i].name;
+        std::printf(
+            "%zu  %.*s\n", i, static_cast<int>(name.size()), name.data()
+        );
+    }
+}
+
+} // namespace tools
@@ -0,0 +1,232 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+#include <vector>
+// own
+#include "core/batch.hpp"
+#include "core/blackjack.hpp"
+#include "core/builtins.hpp"
+#include "core/continuousshoe.hpp"
+#include "core/random.hpp"
+#include "core/shoe.hpp"
+#include "tools/arguments.hpp"
+
+/*
+ * kcuckounter-bench times the batch counting kernels against the scalar
+ * path and the card by card Strategy::update loop the game uses, and
+ * dealing from an eight deck shoe against a continuous shuffling machine
+ * and against playing blackjack rounds with the cards.
+ */
+
+namespace {
+struct Options {
+    std::int64_t cards = 10000000;
+    std::int32_t repeat = 5;
+};
+
+void print_usage(std::FILE* stream) {
+    std::fprintf(
+        stream,
+        "usage: kcuckounter-bench [options]\n"
+        "  --cards N    cards in the stream (10000000)\n"
+        "  --repeat N   runs per measurement, the fastest is reported (5)\n"
+    );
+}
+
+/** @return the exit code if the program should stop, nothing to run */
+std::optional<int>
+parse_options(const int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view option(argv[i]);
+        if (option == "--help" || option == "-h") {
+            print_usage(stdout);
+            return EXIT_SUCCESS;
+        }
+        std::int64_t number = 0;
+        if (i + 1 == argc || !tools::parse_integer(argv[i + 1], number)
+            || number <= 0) {
+            std::fprintf(stderr, "invalid value for %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        ++i;
+        if (option == "--cards") {
+            options.cards = number;
+        } else if (option == "--repeat") {
+            number = std::min<std::int64_t>(number, 1000);
+            options.repeat = static_cast<std::int32_t>(number);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i - 1]);
+            print_usage(stderr);
+            return EXIT_FAILURE;
+        }
+    }
+    return std::nullopt;
+}
+
+/** Fastest of @p repeat runs of @p body, in seconds. */
+template <typename Body>
+double fastest(const std::int32_t repeat, const Body& body) {
+    double best = 0.0;
+    for (std::int32_t i = 0; i < repeat; ++i) {
+        const auto started = std::chrono::steady_clock::now();
+        body();
+        const double seconds = std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - started
+        )
+                                   .count();
+        best = i ? std::min(best, seconds) : seconds;
+    }
+    return best;
+}
+
+void report(
+    const char* name, const double seconds, const double baseline,
+    const double operations, const char* unit = "counts"
+) {
+    std::printf(
+        "%-22s %9.3f ms %10.1f M %s/s %7.2fx\n", name, seconds * 1e3,
+        operations / seconds / 1e6, unit, baseline / seconds
+    );
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (const auto status = parse_options(argc, argv, options)) {
+        return *status;
+    }
+
+    std::vector<core::Weights> weights;
+    std::vector<core::Strategy> strategies;
+    for (const core::BuiltinStrategy& builtin : core::builtin_strategies()) {
+        weights.push_back(builtin.weights);
+        strategies.emplace_back(builtin.weights);
+    }
+    core::Random rng(1);
+    std::vector<std::int32_t> cards(static_cast<std::size_t>(options.cards));
+    for (std::int32_t& card : cards) {
+        card = core::make_card(rng.bounded(4), rng.bounded(core::King + 1));
+    }
+    const double card_counts = static_cast<double>(cards.size())
+        * static_cast<double>(weights.size());
+
+    const core::CountBatch scalar(weights, core::CountKernel::Scalar);
+    const core::CountBatch best(weights);
+    std::vector<std::int32_t> counts(weights.size());
+    std::vector<std::int32_t> traces(cards.size() * weights.size());
+    std::int64_t checksum = 0;
+
+    std::printf(
+        "%zu cards, %zu strategies, best kernel %s\n", cards.size(),
+        weights.size(), core::kernel_name(best.get_kernel())
+    );
+    const double by_card = fastest(options.repeat, [&] {
+        for (std::size_t s = 0; s < strategies.size(); ++s) {
+            std::int32_t count = 0;
+            for (const std::int32_t card : cards) {
+                if (!core::is_joker(card)) {
+                    count = strategies[s].update(count, core::rank_of(card));
+                }
+            }
+            checksum += count;
+        }
+    });
+    report("Strategy::update", by_card, by_card, card_counts);
+    const double scalar_count = fastest(options.repeat, [&] {
+        scalar.count(cards, counts);
+    });
+    report("count scalar", scalar_count, by_card, card_counts);
+    const double best_count = fastest(options.repeat, [&] {
+        best.count(cards, counts);
+    });
+    report("count best", best_count, by_card, card_counts);
+    const double scalar_trace = fastest(options.repeat, [&] {
+        scalar.trace(cards, counts, traces);
+    });
+    report("trace scalar", scalar_trace, scalar_trace, card_counts);
+    const double best_trace = fastest(options.repeat, [&] {
+        best.trace(cards, counts, traces);
+    });
+    report("trace best", best_trace, scalar_trace, card_counts);
+
+    // keep the results alive so no loop is optimised away
+    for (const std::int32_t count : counts) {
+        checksum += count;
+    }
+    checksum += traces.back();
+
+    // the shoe is refilled whenever it runs out, as a table would
+    constexpr std::int32_t shoe_decks = 8;
+    const auto deals = static_cast<double>(options.cards);
+    core::Shoe shoe;
+    const double shoe_draw = fastest(options.repeat, [&] {
+        for (std::int64_t i = 0; i < options.cards; ++i) {
+            if (shoe.empty()) {
+                shoe.fill(shoe_decks, rng);
+            }
+            checksum += shoe.draw();
+        }
+    });
+    report("Shoe::draw", shoe_draw, shoe_draw, deals, "cards");
+    core::ContinuousShoe machine;
+    machine.fill(shoe_decks, 20);
+    const double machine_draw = fastest(options.repeat, [&] {
+        for (std::int64_t i = 0; i < options.cards; ++i) {
+            checksum += machine.draw(rng);
+        }
+    });
+    report(
+        "ContinuousShoe::draw", machine_draw, shoe_draw, deals, "cards"
+    );
+    core::BlackjackRound round;
+    round.set_seats(1);
+    std::int64_t rounds = 0;
+    const double round_play = fastest(options.repeat, [&] {
+        rounds = 0;
+        for (std::int64_t i = 0; i < options.cards; ++i) {
+            if (shoe.empty()) {
+                shoe.fill(shoe_decks, rng);
+            }
+            const std::int32_t card = shoe.draw();
+            if (!core::is_joker(card) && round.add(core::rank_of(card))) {
+                checksum += round.get_net();
+                ++rounds;
+            }
+        }
+    });
+    report("BlackjackRound::add", round_play, shoe_draw, deals, "cards");
+    std::printf(
+        "%-22s %9s    %10.1f M rounds/s\n", "", "",
+        static_cast<double>(rounds) / round_play / 1e6
+    );
+    std::printf("checksum %lld\n", static_cast<long long>(checksum));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,198 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+// own
+#include "core/builtins.hpp"
+#include "core/distribution.hpp"
+#include "core/library.hpp"
+#include "tools/arguments.hpp"
+
+/*
+ * kcuckounter-dist prints the exact distribution of the running or true
+ * count at a given depth of the shoe, for a built-in strategy or for any
+ * weights given on the command line.
+ */
+
+namespace {
+struct Options {
+    core::Weights weights = core::builtin_strategies()[1].weights;
+    std::int32_t scale = 1;
+    std::string name { core::builtin_strategies()[1].name };
+    std::int32_t decks = 6;
+    double penetration = 0.75;
+    std::optional<std::int32_t> cards;
+    std::optional<std::int32_t> at_least;
+    bool true_count = false;
+};
+
+void print_usage(std::FILE* stream) {
+    std::fprintf(
+        stream,
+        "usage: kcuckounter-dist [options]\n"
+        "  --strategy S     built-in strategy by index or name (1)\n"
+        "  --weights W      13 comma separated weights for Ace..King, such\n"
+        "                   as 0.5 for halves\n"
+        "  --decks N        decks in the shoe, at most 16 (6)\n"
+        "  --penetration P  share of the shoe dealt (0.75)\n"
+        "  --cards N        cards dealt, instead of --penetration\n"
+        "  --true           distribution of the true count, rounded down\n"
+        "  --at-least X     only print the probability of a count >= X\n"
+        "  --list           list the built-in strategies\n"
+    );
+}
+
+/** @return the exit code if the program should stop, nothing to run */
+std::optional<int>
+parse_options(const int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view option(argv[i]);
+        if (option == "--help" || option == "-h") {
+            print_usage(stdout);
+            return EXIT_SUCCESS;
+        }
+        if (option == "--list") {
+            tools::print_strategies();
+            return EXIT_SUCCESS;
+        }
+        if (option == "--true") {
+            options.true_count = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            std::fprintf(stderr, "missing value for %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        const char* value = argv[++i];
+        std::int64_t number = 0;
+        bool valid;
+        if (option == "--strategy") {
+            std::size_t index = 0;
+            valid = tools::parse_strategy(value, index);
+            if (valid) {
+                options.weights = core::builtin_strategies()[index].weights;
+                options.scale = core::builtin_strategies()[index].scale;
+                options.name = core::builtin_strategies()[index].name;
+            }
+        } else if (option == "--weights") {
+            valid = tools::parse_weights(
+                value, options.weights, options.scale
+            );
+            options.name = value;
+        } else if (option == "--decks") {
+            valid = tools::parse_integer(value, number) && number > 0
+                && number <= core::CountDistribution::max_decks;
+            options.decks = static_cast<std::int32_t>(number);
+        } else if (option == "--penetration") {
+            valid = tools::parse_number(value, options.penetration)
+                && options.penetration >= 0.0 && options.penetration <= 1.0;
+        } else if (option == "--cards") {
+            valid = tools::parse_integer(value, number) && number >= 0
+                && number <= 16 * core::deck_size;
+            options.cards = static_cast<std::int32_t>(number);
+        } else if (option == "--at-least") {
+            valid = tools::parse_integer(value, number)
+                && std::abs(number) < 100000;
+            options.at_least = static_cast<std::int32_t>(number);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i - 1]);
+            print_usage(stderr);
+            return EXIT_FAILURE;
+        }
+        if (!valid) {
+            std::fprintf(
+                stderr, "invalid value for %s: %s\n", argv[i - 1], value
+            );
+            return EXIT_FAILURE;
+        }
+    }
+    return std::nullopt;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (const auto status = parse_options(argc, argv, options)) {
+        return *status;
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    const auto table = core::CountDistribution::get(
+        options.weights, options.decks
+    );
+    const std::int32_t dealt = std::min(
+        options.cards.value_or(table->at_penetration(options.penetration)),
+        table->total_cards()
+    );
+    const core::Distribution distribution = options.true_count
+        ? table->true_count(dealt, options.scale)
+        : table->running_count(dealt);
+    // the true count is in points already, the running count in units
+    const std::int32_t unit = options.true_count ? 1 : options.scale;
+    const double milliseconds = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - started
+    )
+                                    .count();
+
+    if (options.at_least) {
+        std::printf(
+            "%.10f\n", distribution.at_least(*options.at_least * unit)
+        );
+        return EXIT_SUCCESS;
+    }
+    std::printf(
+        "%s count, %s, %d decks, %d of %d cards dealt (%.2f ms)\n",
+        options.true_count ? "true" : "running", options.name.c_str(),
+        options.decks, dealt, table->total_cards(), milliseconds
+    );
+    std::printf(
+        "mean %.4f  sd %.4f\n\n", distribution.mean() / unit,
+        std::sqrt(distribution.variance()) / unit
+    );
+    std::printf("count  probability  at least\n");
+    double tail = 1.0;
+    for (std::size_t i = 0; i < distribution.probabilities.size(); ++i) {
+        const double p = distribution.probabilities[i];
+        // skip the far tails, which are too unlikely to print
+        if (p >= 5e-7) {
+            std::printf(
+                "%5s  %11.7f  %8.6f\n",
+                core::format_points(
+                    distribution.offset + static_cast<std::int32_t>(i), unit
+                )
+                    .c_str(),
+                p, std::max(tail, 0.0)
+            );
+        }
+        tail -= p;
+    }
+    return EXIT_SUCCESS;
+}
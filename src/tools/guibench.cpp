@@ -0,0 +1,556 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Qt
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLayout>
+#include <QPixmap>
+#include <QStandardPaths>
+#include <QSvgRenderer>
+// std
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <utility>
+#include <vector>
+// own
+#include "settings.hpp"
+#include "strategy/strategyinfo.hpp"
+#include "table/table.hpp"
+#include "table/tableslot.hpp"
+#include "widgets/cards.hpp"
+
+/*
+ * kcuckounter-gui-bench times the widget side of the game: shuffling and
+ * naming cards, rendering card pixmaps, laying out and dealing on a table
+ * and opening the strategy dialog. It runs on the offscreen platform
+ * unless QT_QPA_PLATFORM says otherwise, prints its results as JSON and
+ * can compare them with an earlier run.
+ */
+
+namespace {
+/** The theme the Table loads on construction. */
+const QString default_theme = QStringLiteral("tigullio-international");
+
+struct Result {
+    QString name;
+    /** What tells apart the runs of one benchmark, such as the decks. */
+    QJsonObject parameters;
+    /** Per operation, in the fastest run. */
+    double nanoseconds;
+    qint64 operations;
+};
+
+/** Identifies a result across runs, such as "shuffle_cards decks=6". */
+QString result_key(const QString& name, const QJsonObject& parameters) {
+    QString key = name;
+    for (auto it = parameters.constBegin(); it != parameters.constEnd();
+         ++it) {
+        key += QLatin1Char(' ') + it.key() + QLatin1Char('=')
+            + it.value().toVariant().toString();
+    }
+    return key;
+}
+
+class Runner {
+public:
+    Runner(const qint32 repeat, QString filter)
+        : repeat(repeat)
+        , filter(std::move(filter)) { }
+
+    /** Whether the benchmark called @p name was selected. */
+    [[nodiscard]] bool wants(const QString& name) const {
+        return name.contains(filter);
+    }
+
+    /** Time @p body, which does @p operations, and keep the fastest run. */
+    void run(
+        const QString& name, const QJsonObject& parameters,
+        const qint64 operations, const std::function<void()>& body
+    ) {
+        run_counted(name, parameters, [&body, operations] {
+            body();
+            return operations;
+        });
+    }
+
+    /**
+     * @brief Time @p body, which returns the operations it did.
+     *
+     * For bodies that may stop early; runs that did nothing are left out,
+     * and so is the benchmark if no run did anything.
+     */
+    void run_counted(
+        const QString& name, const QJsonObject& parameters,
+        const std::function<qint64()>& body
+    ) {
+        double best = 0.0;
+        qint64 best_operations = 0;
+        for (qint32 i = 0; i < repeat; ++i) {
+            const auto started = std::chrono::steady_clock::now();
+            const qint64 operations = body();
+            const double seconds = std::chrono::duration<double>(
+                                       std::chrono::steady_clock::now()
+                                       - started
+            )
+                                       .count();
+            if (operations <= 0) {
+                continue;
+            }
+            const double nanoseconds
+                = seconds * 1e9 / static_cast<double>(operations);
+            if (!best_operations || nanoseconds < best) {
+                best = nanoseconds;
+                best_operations = operations;
+            }
+        }
+        if (!best_operations) {
+            std::fprintf(
+                stderr, "%-48s %15s\n",
+                qPrintable(result_key(name, parameters)), "no operations"
+            );
+            return;
+        }
+        std::fprintf(
+            stderr, "%-48s %12.1f ns\n",
+            qPrintable(result_key(name, parameters)), best
+        );
+        results.push_back({ name, parameters, best, best_operations });
+    }
+
+    [[nodiscard]] const std::vector<Result>& get_results() const {
+        return results;
+    }
+
+private:
+    qint32 repeat;
+    QString filter;
+    std::vector<Result> results;
+};
+
+/** Installed SVG card themes by name, the default one first. */
+QStringList installed_themes() {
+    QStringList themes { default_theme };
+    const QStringList roots = QStandardPaths::locateAll(
+        QStandardPaths::GenericDataLocation, QStringLiteral("carddecks"),
+        QStandardPaths::LocateDirectory
+    );
+    for (const QString& root : roots) {
+        const QStringList decks = QDir(root).entryList(
+            { QStringLiteral("svg-*") }, QDir::Dirs
+        );
+        for (const QString& deck : decks) {
+            const QString theme = deck.mid(4);
+            if (!themes.contains(theme)) {
+                themes.push_back(theme);
+            }
+        }
+    }
+    return themes;
+}
+
+QString theme_path(const QString& theme) {
+    return QStandardPaths::locate(
+        QStandardPaths::GenericDataLocation,
+        QStringLiteral("carddecks/svg-%1/%1.svgz").arg(theme)
+    );
+}
+
+/** The slot waiting for a deck count, the last one on the table. */
+TableSlot* fake_slot(const Table& table) {
+    for (TableSlot* slot : table.findChildren<TableSlot*>()) {
+        if (!slot->isHidden() && slot->is_fake()) {
+            return slot;
+        }
+    }
+    return nullptr;
+}
+
+/** Start a game with @p count playing slots. */
+void set_up_table(Table& table, const qint32 level, const qint32 count) {
+    table.create_new_game(level);
+    for (qint32 i = 0; i < count; ++i) {
+        fake_slot(table)->activate(1);
+    }
+}
+
+void bench_cards(Runner& runner) {
+    qint64 checksum = 0;
+    if (runner.wants(QStringLiteral("shuffle_cards"))) {
+        constexpr qint32 shuffles = 200;
+        for (const qint32 decks : { 1, 2, 4, 6, 8 }) {
+            runner.run(
+                QStringLiteral("shuffle_cards"), { { "decks", decks } },
+                shuffles,
+                [&] {
+                    for (qint32 i = 0; i < shuffles; ++i) {
+                        checksum += Cards::shuffle_cards(decks).size();
+                    }
+                }
+            );
+        }
+    }
+    if (runner.wants(QStringLiteral("card_name"))) {
+        // every suit and rank, jokers included, in both flavours
+        std::vector<qint32> ids;
+        for (qint32 suit = Cards::Clubs; suit <= Cards::Spades; ++suit) {
+            for (qint32 rank = Cards::Joker; rank <= Cards::King; ++rank) {
+                ids.push_back((suit << 8) | rank);
+            }
+        }
+        constexpr qint32 rounds = 1000;
+        runner.run(
+            QStringLiteral("card_name"), {},
+            rounds * 2 * static_cast<qint64>(ids.size()),
+            [&] {
+                for (qint32 i = 0; i < rounds; ++i) {
+                    for (const qint32 id : ids) {
+                        checksum += Cards::card_name(id).size();
+                        checksum += Cards::card_name(id, 1).size();
+                    }
+                }
+            }
+        );
+    }
+    std::fprintf(stderr, "checksum %lld\n", static_cast<long long>(checksum));
+}
+
+void bench_pixmaps(Runner& runner) {
+    if (!runner.wants(QStringLiteral("update_pixmap"))) {
+        return;
+    }
+    constexpr qint32 cards = 52;
+    for (const QString& theme : installed_themes()) {
+        QSvgRenderer renderer(theme_path(theme));
+        if (!renderer.isValid()) {
+            continue;
+        }
+        const QSizeF bounds = renderer.boundsOnElement("back").size();
+        for (const double scale : { 0.5, 1.0, 2.0 }) {
+            for (const bool rotated : { false, true }) {
+                QSize size = (bounds * scale).toSize();
+                if (rotated) {
+                    size.transpose();
+                }
+                Cards card(&renderer);
+                card.setFixedSize(size);
+                card.set_rotated(rotated);
+                QPixmap target(size);
+                // a new card marks the pixmap dirty, painting renders it
+                runner.run(
+                    QStringLiteral("update_pixmap"),
+                    { { "theme", theme },
+                      { "width", size.width() },
+                      { "rotated", rotated } },
+                    cards,
+                    [&] {
+                        for (qint32 i = 0; i < cards; ++i) {
+                            card.set_id(
+                                ((i % 4) << 8) | (i / 4 % Cards::King + 1)
+                            );
+                            card.render(&target);
+                        }
+                    }
+                );
+            }
+        }
+    }
+}
+
+void bench_layout(Runner& runner) {
+    if (!runner.wants(QStringLiteral("calculate_new_column_count"))) {
+        return;
+    }
+    constexpr qint32 resizes = 50;
+    for (const qint32 slots : { 1, 10, 30, 100 }) {
+        Table table;
+        table.resize(1280, 800);
+        table.show();
+        set_up_table(table, 1, slots - 1);
+        // every resize recomputes the columns and reorganises the grid
+        runner.run(
+            QStringLiteral("calculate_new_column_count"),
+            { { "slots", slots } }, resizes,
+            [&] {
+                for (qint32 i = 0; i < resizes; ++i) {
+                    table.resize(i % 2 ? QSize(1280, 800) : QSize(800, 1280));
+                    table.layout()->activate();
+                }
+            }
+        );
+    }
+}
+
+void bench_dealing(Runner& runner) {
+    if (!runner.wants(QStringLiteral("pick_up_cards"))) {
+        return;
+    }
+    constexpr qint32 slots = 10;
+    constexpr qint32 ticks = 2000;
+    // the card modes of Table::set_card_mode()
+    const std::pair<qint32, const char*> modes[] = {
+        { 1, "ordered" },
+        { 3, "random" },
+        { 5, "adaptive" },
+        { 10, "simultaneous" },
+    };
+    for (const auto& [level, mode] : modes) {
+        Table table;
+        table.resize(1280, 800);
+        table.show();
+        set_up_table(table, level, slots);
+        // slots ask and finish while the engine deals, answer afterwards
+        QVector<TableSlot*> quizzed;
+        QVector<TableSlot*> finished;
+        for (TableSlot* slot : table.findChildren<TableSlot*>()) {
+            QObject::connect(slot, &TableSlot::user_quizzed, [&, slot] {
+                quizzed.push_back(slot);
+            });
+            QObject::connect(
+                slot, &TableSlot::table_slot_finished,
+                [&, slot] { finished.push_back(slot); }
+            );
+        }
+        bool over = false;
+        QObject::connect(&table, &Table::game_over, [&] { over = true; });
+        table.pause(false);
+        // a game that runs out of slots stops early, time the ticks it ran
+        runner.run_counted(
+            QStringLiteral("pick_up_cards"), { { "mode", mode } },
+            [&] {
+                qint64 done = 0;
+                for (; done < ticks && !over; ++done) {
+                    QMetaObject::invokeMethod(
+                        &table, "pick_up_cards", Qt::DirectConnection
+                    );
+                    for (TableSlot* slot : std::as_const(quizzed)) {
+                        slot->user_checking();
+                    }
+                    quizzed.clear();
+                    for (TableSlot* slot : std::as_const(finished)) {
+                        slot->reshuffle_deck();
+                    }
+                    finished.clear();
+                }
+                return done;
+            }
+        );
+        if (over) {
+            std::fprintf(stderr, "the %s game ran out of slots\n", mode);
+        }
+    }
+}
+
+void bench_strategy_info(Runner& runner) {
+    if (!runner.wants(QStringLiteral("StrategyInfo"))) {
+        return;
+    }
+    QSvgRenderer renderer(theme_path(default_theme));
+    constexpr qint32 dialogs = 20;
+    runner.run(QStringLiteral("StrategyInfo"), {}, dialogs, [&] {
+        for (qint32 i = 0; i < dialogs; ++i) {
+            const StrategyInfo info(&renderer);
+        }
+    });
+}
+
+QJsonDocument to_json(const std::vector<Result>& results) {
+    QJsonArray array;
+    for (const Result& result : results) {
+        array.append(QJsonObject { { "name", result.name },
+                                   { "parameters", result.parameters },
+                                   { "ns_per_op", result.nanoseconds },
+                                   { "operations", result.operations } });
+    }
+    return QJsonDocument(QJsonObject {
+        { "platform", QGuiApplication::platformName() },
+        { "results", array },
+    });
+}
+
+/**
+ * @brief Print the change against a baseline run for every result.
+ * @return how many results got slower by more than @p threshold
+ */
+qint32 compare(
+    const std::vector<Result>& results, const QJsonDocument& baseline,
+    const double threshold
+) {
+    QHash<QString, double> before;
+    const QJsonArray saved = baseline.object().value("results").toArray();
+    for (const QJsonValue value : saved) {
+        const QJsonObject entry = value.toObject();
+        before.insert(
+            result_key(
+                entry.value("name").toString(),
+                entry.value("parameters").toObject()
+            ),
+            entry.value("ns_per_op").toDouble()
+        );
+    }
+    qint32 regressions = 0;
+    for (const Result& result : results) {
+        const QString key = result_key(result.name, result.parameters);
+        const double old = before.value(key);
+        if (old <= 0.0) {
+            std::fprintf(stderr, "%-48s %12s\n", qPrintable(key), "new");
+            continue;
+        }
+        const double change = result.nanoseconds / old - 1.0;
+        const bool slower = change > threshold;
+        regressions += slower ? 1 : 0;
+        std::fprintf(
+            stderr, "%-48s %+11.1f%%%s\n", qPrintable(key), change * 100.0,
+            slower ? "  slower" : ""
+        );
+    }
+    return regressions;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    const QApplication app(argc, argv);
+    // Settings persist through ConfigStore, keep the user's state.json out
+    QStandardPaths::setTestModeEnabled(true);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral(
+        "Times the widget hot paths and prints the results as JSON."
+    ));
+    parser.addHelpOption();
+    const QCommandLineOption repeat_option(
+        QStringLiteral("repeat"),
+        QStringLiteral("Runs per measurement, the fastest is reported."),
+        QStringLiteral("n"), QStringLiteral("5")
+    );
+    const QCommandLineOption filter_option(
+        QStringLiteral("filter"),
+        QStringLiteral("Only run benchmarks whose name contains the text."),
+        QStringLiteral("text")
+    );
+    const QCommandLineOption output_option(
+        QStringLiteral("output"),
+        QStringLiteral("Write the JSON to a file instead of stdout."),
+        QStringLiteral("file")
+    );
+    const QCommandLineOption baseline_option(
+        QStringLiteral("baseline"),
+        QStringLiteral("Compare with the JSON of an earlier run."),
+        QStringLiteral("file")
+    );
+    const QCommandLineOption threshold_option(
+        QStringLiteral("threshold"),
+        QStringLiteral("Percent slower than the baseline that fails."),
+        QStringLiteral("percent"), QStringLiteral("10")
+    );
+    parser.addOptions({ repeat_option, filter_option, output_option,
+                        baseline_option, threshold_option });
+    parser.process(app);
+
+    bool valid = false;
+    const qint32 repeat = parser.value(repeat_option).toInt(&valid);
+    if (!valid || repeat <= 0) {
+        std::fprintf(stderr, "invalid value for --repeat\n");
+        return EXIT_FAILURE;
+    }
+    const double threshold = parser.value(threshold_option).toDouble(&valid);
+    if (!valid || threshold < 0.0) {
+        std::fprintf(stderr, "invalid value for --threshold\n");
+        return EXIT_FAILURE;
+    }
+    QJsonDocument baseline;
+    if (parser.isSet(baseline_option)) {
+        QFile file(parser.value(baseline_option));
+        if (!file.open(QIODevice::ReadOnly)) {
+            std::fprintf(
+                stderr, "cannot open %s\n", qPrintable(file.fileName())
+            );
+            return EXIT_FAILURE;
+        }
+        baseline = QJsonDocument::fromJson(file.readAll());
+        if (!baseline.isObject()) {
+            std::fprintf(
+                stderr, "%s is not a benchmark result\n",
+                qPrintable(file.fileName())
+            );
+            return EXIT_FAILURE;
+        }
+    }
+    if (theme_path(default_theme).isEmpty()) {
+        std::fprintf(
+            stderr, "the card theme %s is not installed\n",
+            qPrintable(default_theme)
+        );
+        return EXIT_FAILURE;
+    }
+
+    // the table reads these; they are saved to the test mode state.json
+    Settings& opts = Settings::instance();
+    opts.begin_changes();
+    opts.set_indexing(true);
+    opts.set_training(true);
+    opts.set_infinity_mode(false);
+    opts.set_quiz_type(Settings::RunningCount);
+    opts.end_changes();
+
+    Runner runner(repeat, parser.value(filter_option));
+    bench_cards(runner);
+    bench_pixmaps(runner);
+    bench_layout(runner);
+    bench_dealing(runner);
+    bench_strategy_info(runner);
+
+    const QByteArray json = to_json(runner.get_results()).toJson();
+    if (parser.isSet(output_option)) {
+        QFile file(parser.value(output_option));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)
+            || file.write(json) != json.size()) {
+            std::fprintf(
+                stderr, "cannot write %s\n", qPrintable(file.fileName())
+            );
+            return EXIT_FAILURE;
+        }
+    } else {
+        std::fwrite(
+            json.constData(), 1, static_cast<std::size_t>(json.size()), stdout
+        );
+    }
+    if (!baseline.isNull()
+        && compare(runner.get_results(), baseline, threshold / 100.0) > 0) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
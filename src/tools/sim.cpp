@@ -0,0 +1,551 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// std
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+// own
+#include "core/builtins.hpp"
+#include "core/cards.hpp"
+#include "core/deviations.hpp"
+#include "core/engine.hpp"
+#include "core/evaluator.hpp"
+#include "core/histogram.hpp"
+#include "core/parallel.hpp"
+#include "tools/arguments.hpp"
+
+/*
+ * kcuckounter-sim deals shoes on a headless table as fast as the machine
+ * allows and reports how the running count and the jokers behave. Every
+ * round restarts the table and plays one shoe per slot to the end; jokers
+ * are answered right away. Continuous shuffling machines never run out, so
+ * a round then stops after one shoe's worth of cards per slot. With seats
+ * the slots also play blackjack by basic strategy with the cards they deal,
+ * and the winnings are reported by the true count at the start of a hand.
+ */
+
+namespace {
+struct Options {
+    std::int64_t rounds = 10000;
+    std::int32_t decks = 6;
+    std::int32_t slots = 4;
+    std::int32_t threads = core::hardware_threads();
+    std::uint64_t seed = core::Random::entropy();
+    core::Engine::mode mode = core::Engine::mode::Ordered;
+    std::size_t strategy = 1;
+    /** Built-in strategies kept as side counts by every slot. */
+    std::vector<std::size_t> side_counts;
+    /** Deal from continuous shuffling machines. */
+    bool continuous = false;
+    std::int32_t shuffle_delay = 20;
+    /** Blackjack players per slot, 0 only counts. */
+    std::int32_t seats = 0;
+    bool histogram = false;
+    bool evaluate = false;
+    bool indices = false;
+};
+
+constexpr std::string_view mode_names[]
+    = { "ordered", "simultaneous", "random", "adaptive" };
+
+void print_usage(std::FILE* stream) {
+    std::fprintf(
+        stream,
+        "usage: kcuckounter-sim [options]\n"
+        "  --rounds N      table rounds to play, one shoe per slot (10000)\n"
+        "  --decks N       decks per shoe (6)\n"
+        "  --slots N       slots on the table (4)\n"
+        "  --mode NAME     ordered, simultaneous, random or adaptive\n"
+        "  --strategy S    built-in strategy by index or name (1)\n"
+        "  --side S        add a built-in strategy as a side count, up to 3\n"
+        "  --csm N         deal from a continuous shuffling machine that\n"
+        "                  returns discards after N more cards\n"
+        "  --seats N       play blackjack by basic strategy with N players\n"
+        "                  per slot, up to 7\n"
+        "  --threads N     worker threads (all cores)\n"
+        "  --seed N        seed for reproducible runs\n"
+        "  --histogram     print the running count histogram\n"
+        "  --evaluate      also print betting correlation and playing "
+        "efficiency\n"
+        "  --indices       also simulate the playing deviation indices\n"
+        "  --list          list the built-in strategies\n"
+    );
+}
+
+/** @return the exit code if the program should stop, nothing to run */
+std::optional<int>
+parse_options(const int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view option(argv[i]);
+        if (option == "--help" || option == "-h") {
+            print_usage(stdout);
+            return EXIT_SUCCESS;
+        }
+        if (option == "--list") {
+            tools::print_strategies();
+            return EXIT_SUCCESS;
+        }
+        if (option == "--histogram") {
+            options.histogram = true;
+            continue;
+        }
+        if (option == "--evaluate") {
+            options.evaluate = true;
+            continue;
+        }
+        if (option == "--indices") {
+            options.indices = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            std::fprintf(stderr, "missing value for %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        const char* value = argv[++i];
+        std::int64_t number = 0;
+        bool valid;
+        if (option == "--mode") {
+            const auto* found = std::find(
+                std::begin(mode_names), std::end(mode_names), value
+            );
+            valid = found != std::end(mode_names);
+            options.mode = static_cast<core::Engine::mode>(
+                found - std::begin(mode_names)
+            );
+        } else if (option == "--strategy") {
+            valid = tools::parse_strategy(value, options.strategy);
+        } else if (option == "--side") {
+            std::size_t index = 0;
+            valid = tools::parse_strategy(value, index)
+                && options.side_counts.size() + 1
+                    < std::size_t { core::CounterSet::max_counters };
+            options.side_counts.push_back(index);
+        } else if (option == "--csm") {
+            valid = tools::parse_integer(value, number) && number >= 0;
+            options.continuous = true;
+            options.shuffle_delay = static_cast<std::int32_t>(
+                std::min<std::int64_t>(number, 64 * core::deck_size)
+            );
+        } else if (option == "--seed") {
+            valid = tools::parse_integer(value, number);
+            options.seed = static_cast<std::uint64_t>(number);
+        } else {
+            valid = tools::parse_integer(value, number) && number > 0;
+            const auto limited = [number](const std::int64_t limit) {
+                return static_cast<std::int32_t>(std::min(number, limit));
+            };
+            if (option == "--rounds") {
+                options.rounds = number;
+            } else if (option == "--decks") {
+                options.decks = limited(64);
+            } else if (option == "--slots") {
+                options.slots = limited(4096);
+            } else if (option == "--seats") {
+                options.seats = limited(core::BlackjackRound::max_seats);
+            } else if (option == "--threads") {
+                options.threads = limited(1024);
+            } else {
+                std::fprintf(stderr, "unknown option %s\n", argv[i - 1]);
+                print_usage(stderr);
+                return EXIT_FAILURE;
+            }
+        }
+        if (!valid) {
+            std::fprintf(
+                stderr, "invalid value for %s: %s\n", argv[i - 1], value
+            );
+            return EXIT_FAILURE;
+        }
+    }
+    return std::nullopt;
+}
+
+constexpr std::int32_t true_count_limit = 6;
+
+/** Index of a true count in Statistics::round_net. */
+std::size_t true_count_bin(const double true_count) {
+    const std::int32_t rounded = std::clamp(
+        core::round_true_count(true_count, core::Rounding::Floor),
+        -true_count_limit, true_count_limit
+    );
+    return static_cast<std::size_t>(rounded + true_count_limit);
+}
+
+struct Statistics {
+    void merge(const Statistics& other) {
+        running.merge(other.running);
+        at_joker.merge(other.at_joker);
+        joker_gap.merge(other.joker_gap);
+        quiz_interval.merge(other.quiz_interval);
+        for (std::size_t i = 0; i < round_net.size(); ++i) {
+            round_net[i].merge(other.round_net[i]);
+        }
+        deals += other.deals;
+    }
+
+    /** Running count after every standard card. */
+    core::Histogram running;
+    /** Running count the player is asked for. */
+    core::Histogram at_joker;
+    /** Cards from the start of the shoe or the previous joker to a joker. */
+    core::Histogram joker_gap;
+    /** Table ticks between two quizzes. */
+    core::Histogram quiz_interval;
+    /**
+     * Blackjack winnings in half bets by the true count at the start of the
+     * round, rounded down and clamped to +-true_count_limit.
+     */
+    std::array<core::Histogram, 2 * true_count_limit + 1> round_net;
+    std::int64_t deals = 0;
+};
+
+class Recorder final : public core::EngineObserver {
+public:
+    Recorder(const core::Engine& engine, const std::int32_t slots)
+        : engine(engine)
+        , dealt(static_cast<std::size_t>(slots))
+        , last_joker(static_cast<std::size_t>(slots))
+        , round_bin(static_cast<std::size_t>(slots)) { }
+
+    void start_round() {
+        std::fill(dealt.begin(), dealt.end(), 0);
+        std::fill(last_joker.begin(), last_joker.end(), 0);
+        std::fill(round_bin.begin(), round_bin.end(), true_count_bin(0.0));
+        last_quiz = -1;
+        ticks = 0;
+    }
+
+    void
+    card_dealt(const std::int32_t handle, const std::int32_t card) override {
+        ++stats.deals;
+        ++dealt[static_cast<std::size_t>(handle)];
+        if (!core::is_joker(card)) {
+            stats.running.add(engine.get_running_count(handle));
+        }
+    }
+
+    void joker_dealt(const std::int32_t handle) override {
+        const auto slot = static_cast<std::size_t>(handle);
+        stats.at_joker.add(engine.get_running_count(
+            handle, engine.get_quizzed_counter(handle)
+        ));
+        stats.joker_gap.add(dealt[slot] - last_joker[slot]);
+        last_joker[slot] = dealt[slot];
+        if (last_quiz >= 0) {
+            stats.quiz_interval.add(
+                static_cast<std::int32_t>(ticks - last_quiz)
+            );
+        }
+        last_quiz = ticks;
+        pending.push_back(handle);
+    }
+
+    void round_finished(const std::int32_t handle) override {
+        std::size_t& bin = round_bin[static_cast<std::size_t>(handle)];
+        stats.round_net[bin].add(engine.get_round(handle).get_net());
+        bin = true_count_bin(engine.get_true_count(handle));
+    }
+
+    Statistics stats;
+    std::vector<std::int32_t> pending;
+    std::int64_t ticks = 0;
+
+private:
+    const core::Engine& engine;
+    std::vector<std::int32_t> dealt;
+    std::vector<std::int32_t> last_joker;
+    /** True count bin at the start of the round each slot plays. */
+    std::vector<std::size_t> round_bin;
+    std::int64_t last_quiz = -1;
+};
+
+struct Worker {
+    explicit Worker(const Options& options)
+        : recorder(engine, options.slots)
+        , continuous(options.continuous)
+        , round_deals(
+              std::int64_t { options.slots } * options.decks * core::deck_size
+          ) {
+        engine.set_mode(options.mode);
+        engine.set_continuous(options.continuous);
+        engine.set_shuffle_delay(options.shuffle_delay);
+        engine.set_round_seats(options.seats);
+        engine.set_observer(&recorder);
+        const core::BuiltinStrategy& builtin
+            = core::builtin_strategies()[options.strategy];
+        const core::Strategy strategy(builtin.weights, builtin.scale);
+        std::vector<core::Strategy> side_counts;
+        for (const std::size_t index : options.side_counts) {
+            const core::BuiltinStrategy& side
+                = core::builtin_strategies()[index];
+            side_counts.emplace_back(side.weights, side.scale);
+        }
+        for (std::int32_t i = 0; i < options.slots; ++i) {
+            const std::int32_t handle = engine.add_slot(true);
+            engine.set_strategy(handle, strategy);
+            engine.set_side_counts(handle, side_counts);
+            engine.set_deck_count(handle, options.decks);
+        }
+    }
+
+    void play_round(const std::uint64_t seed) {
+        // seeding per round keeps results independent of the scheduling
+        engine.seed(seed);
+        engine.restart();
+        recorder.start_round();
+        for (const std::int32_t handle : engine.get_order()) {
+            engine.reshuffle(handle);
+        }
+        const std::int64_t stop = recorder.stats.deals + round_deals;
+        while ((!continuous || recorder.stats.deals < stop) && engine.tick()) {
+            ++recorder.ticks;
+            for (const std::int32_t handle : recorder.pending) {
+                engine.answer(
+                    handle,
+                    engine.get_running_count(
+                        handle, engine.get_quizzed_counter(handle)
+                    )
+                );
+            }
+            recorder.pending.clear();
+        }
+    }
+
+    core::Engine engine { 0 };
+    Recorder recorder;
+    bool continuous;
+    /** Cards a round deals from the machines. */
+    std::int64_t round_deals;
+};
+
+void print_summary(const char* title, const core::Histogram& histogram) {
+    if (!histogram.count()) {
+        std::printf("%-28s no samples\n", title);
+        return;
+    }
+    std::printf(
+        "%-28s mean %8.3f  sd %7.3f  min %4d  p1 %4d  p50 %4d  p99 %4d  max "
+        "%4d\n",
+        title, histogram.mean(), std::sqrt(histogram.variance()),
+        histogram.min(), histogram.quantile(0.01), histogram.quantile(0.5),
+        histogram.quantile(0.99), histogram.max()
+    );
+}
+
+void print_histogram(const core::Histogram& histogram) {
+    std::int64_t peak = 0;
+    const std::int32_t last = histogram.max();
+    for (std::int32_t value = histogram.min(); value <= last; ++value) {
+        peak = std::max(peak, histogram.at(value));
+    }
+    for (std::int32_t value = histogram.min(); value <= last; ++value) {
+        const std::int64_t count = histogram.at(value);
+        const int width = peak ? static_cast<int>(60 * count / peak) : 0;
+        std::printf(
+            "%5d %12" PRId64 " %8.5f%% %.*s\n", value, count,
+            100.0 * static_cast<double>(count)
+                / static_cast<double>(histogram.count()),
+            width,
+            "############################################################"
+        );
+    }
+}
+
+/** Simulated deviation indices next to the shipped ones, if any. */
+void print_indices(const Options& options) {
+    const core::BuiltinStrategy& builtin
+        = core::builtin_strategies()[options.strategy];
+    core::IndexParameters parameters;
+    parameters.deck_count = options.decks;
+    parameters.seed = options.seed;
+    parameters.threads = options.threads;
+    const auto indices
+        = core::compute_indices(builtin.weights, builtin.scale, parameters);
+    const core::IndexTable* shipped
+        = core::builtin_index_tables[options.strategy];
+    constexpr std::string_view plays[] = { "hit",   "stand",  "double",
+                                           "split", "surrender", "insure",
+                                           "no insurance" };
+    std::printf("deviation              index%s\n", shipped ? "  shipped" : "");
+    for (std::size_t d = 0; d < core::deviation_count; ++d) {
+        const core::Deviation& deviation = core::deviations[d];
+        const std::string_view above
+            = plays[static_cast<std::size_t>(deviation.above)];
+        std::printf(
+            "%2d,%2d vs %2d %-10.*s %+5d", deviation.first, deviation.second,
+            deviation.up, static_cast<int>(above.size()), above.data(),
+            (*indices)[d]
+        );
+        if (shipped) {
+            std::printf("  %+7d", (*shipped)[d]);
+        }
+        std::printf("\n");
+    }
+}
+
+/** Blackjack winnings per seat, overall and by true count. */
+void print_rounds(const Statistics& stats, const std::int32_t seats) {
+    core::Histogram all;
+    for (const core::Histogram& net : stats.round_net) {
+        all.merge(net);
+    }
+    if (!all.count()) {
+        std::printf("no blackjack rounds finished\n");
+        return;
+    }
+    // half bets over all seats to whole bets per seat, in percent
+    const double percent = 100.0 / (2.0 * seats);
+    std::printf(
+        "%" PRId64 " blackjack rounds, %d seats, %+.3f%% of the bet per seat"
+        "\n",
+        all.count(), seats, all.mean() * percent
+    );
+    std::printf(
+        "by true count at the start, clamped to +-%d\n", true_count_limit
+    );
+    for (std::size_t bin = 0; bin < stats.round_net.size(); ++bin) {
+        const core::Histogram& net = stats.round_net[bin];
+        if (!net.count()) {
+            continue;
+        }
+        const auto true_count
+            = static_cast<std::int32_t>(bin) - true_count_limit;
+        std::printf(
+            "%+5d %12" PRId64 " rounds %+8.3f%%\n", true_count, net.count(),
+            net.mean() * percent
+        );
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (const auto status = parse_options(argc, argv, options)) {
+        return *status;
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    for (std::int32_t i = 0; i < options.threads; ++i) {
+        workers.push_back(std::make_unique<Worker>(options));
+    }
+    const std::int64_t grain = std::max<std::int64_t>(
+        1, options.rounds / (16 * std::int64_t(options.threads))
+    );
+
+    const auto started = std::chrono::steady_clock::now();
+    core::parallel_for(
+        options.rounds, grain, options.threads,
+        [&](const std::int32_t worker, const std::int64_t begin,
+            const std::int64_t end) {
+            Worker& state = *workers[static_cast<std::size_t>(worker)];
+            for (std::int64_t round = begin; round < end; ++round) {
+                const std::uint64_t mix = static_cast<std::uint64_t>(round)
+                    * 0x9e3779b97f4a7c15ULL;
+                state.play_round(options.seed ^ mix);
+            }
+        }
+    );
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - started
+    )
+                               .count();
+
+    Statistics total;
+    for (const auto& worker : workers) {
+        total.merge(worker->recorder.stats);
+    }
+    const std::string_view name
+        = core::builtin_strategies()[options.strategy].name;
+    const std::int32_t scale
+        = core::builtin_strategies()[options.strategy].scale;
+    std::printf(
+        "%" PRId64 " rounds, %d slots, %d decks, %.*s, mode %.*s, %d threads, "
+        "seed %" PRIu64 "\n",
+        options.rounds, options.slots, options.decks,
+        static_cast<int>(name.size()), name.data(),
+        static_cast<int>(mode_names[static_cast<int>(options.mode)].size()),
+        mode_names[static_cast<int>(options.mode)].data(), options.threads,
+        options.seed
+    );
+    if (scale > 1) {
+        std::printf("counts are in 1/%d points\n", scale);
+    }
+    if (options.continuous) {
+        std::printf(
+            "continuous shuffling, discards return after %d cards\n",
+            options.shuffle_delay
+        );
+    }
+    for (const std::size_t index : options.side_counts) {
+        const std::string_view side = core::builtin_strategies()[index].name;
+        std::printf(
+            "side count %.*s\n", static_cast<int>(side.size()), side.data()
+        );
+    }
+    std::printf(
+        "%" PRId64 " deals in %.3f s, %.2f M deals/s\n", total.deals, seconds,
+        static_cast<double>(total.deals) / seconds / 1e6
+    );
+    print_summary("running count", total.running);
+    print_summary("running count at jokers", total.at_joker);
+    print_summary("joker gap in cards", total.joker_gap);
+    print_summary("ticks between quizzes", total.quiz_interval);
+    if (options.seats > 0) {
+        print_rounds(total, options.seats);
+    }
+    if (options.indices) {
+        print_indices(options);
+    }
+    if (options.evaluate) {
+        core::EvaluationParameters parameters;
+        parameters.deck_count = options.decks;
+        parameters.seed = options.seed;
+        parameters.threads = options.threads;
+        const auto evaluation = core::evaluate(
+            core::builtin_strategies()[options.strategy].weights, parameters
+        );
+        std::printf(
+            "betting correlation %.3f, playing efficiency %.3f, insurance "
+            "correlation %.3f, true count variance %.3f\n",
+            evaluation->betting_correlation, evaluation->playing_efficiency,
+            evaluation->insurance_correlation,
+            evaluation->count_variance / (scale * scale)
+        );
+    }
+    if (options.histogram && total.running.count()) {
+        std::printf("\nrunning count histogram\n");
+        print_histogram(total.running);
+    }
+    return EXIT_SUCCESS;
+}
@@ -26,7 +26,11 @@
 #include <QPainter>
 #include <QRandomGenerator>
 #include <QSvgRenderer>
+// std
+#include <array>
 // own
+#include "core/cards.hpp"
+#include "core/shoe.hpp"
 #include "widgets/cards.hpp"
 
 // #include "settings.hpp"
@@ -34,30 +38,44 @@
 QList<qint32> Cards::shuffle_cards(
     const qint32 deck_count, const qint32 shuffle_coefficient
 ) {
-    QList<qint32> deck = generate_deck(deck_count);
-    const qint32 threshold
-        = static_cast<qint32>(deck.size()) / (deck_count * shuffle_coefficient);
-    bool flag;
-
-    do {
-        flag = false;
-        std::ranges::shuffle(deck, *QRandomGenerator::global());
-        qint32 lastJokerIndex = -1;
-        for (int i = 0; i < deck.size(); i++) {
-            if (is_joker(deck[i])) {
-                if (i - lastJokerIndex < threshold) {
-                    flag = true;
-                    break;
+    core::Random rng(QRandomGenerator::global()->generate64());
+    std::vector<std::int32_t> deck;
+    core::shuffle_shoe(deck, deck_count, shuffle_coefficient, rng);
+    return { deck.cbegin(), deck.cend() };
+}
+
+QString Cards::card_name(const qint32 id, const qint32 standard) {
+    constexpr qint32 ranks = King + 1;
+    constexpr qint32 suits = Spades + 1;
+    // every valid id maps to one of few names, build them once and share
+    static const std::array<QString, 2 * suits * ranks> names = [] {
+        std::array<QString, 2 * suits * ranks> table;
+        for (qint32 flavour = 0; flavour < 2; ++flavour) {
+            for (qint32 suit = Clubs; suit <= Spades; ++suit) {
+                for (qint32 rank = Joker; rank <= King; ++rank) {
+                    const auto index = static_cast<std::size_t>(
+                        (flavour * suits + suit) * ranks + rank
+                    );
+                    table[index] = build_card_name(
+                        ((suit & 0xff) << 8) | (rank & 0xff), flavour
+                    );
                 }
-                lastJokerIndex = i;
             }
         }
-    } while (flag);
+        return table;
+    }();
 
-    return deck;
+    const qint32 rank = get_rank(id);
+    const qint32 suit = get_suit(id);
+    if (id < 0 || rank > King || suit > Spades) {
+        return build_card_name(id, standard);
+    }
+    return names[static_cast<std::size_t>(
+        ((standard & 1) * suits + suit) * ranks + rank
+    )];
 }
 
-QString Cards::card_name(const qint32 id, const qint32 standard) {
+QString Cards::build_card_name(const qint32 id, const qint32 standard) {
     const qint32 rank = get_rank(id);
     const qint32 suit = get_suit(id);
     QString name = get_rank_name(rank, standard & 1);
@@ -72,18 +90,8 @@ QString Cards::card_name(const qint32 id, const qint32 standard) {
 }
 
 QList<qint32> Cards::generate_deck(const qint32 deck_count) {
-    QList<qint32> deck;
-    for (qint32 i = 0; i < deck_count; i++) {
-        for (qint32 rank = Ace; rank <= King; rank++) {
-            for (qint32 suit = Clubs; suit <= Spades; suit++) {
-                deck.append(((suit & 0xff) << 8) | (rank & 0xff));
-            }
-        }
-        for (int colour = Black; colour <= Red; colour++) {
-            deck.append((colour & 0xff) << 8);
-        }
-    }
-    return deck;
+    const std::vector<std::int32_t> deck = core::generate_deck(deck_count);
+    return { deck.cbegin(), deck.cend() };
 }
 
 QString Cards::get_colour_name(const qint32 colour) {
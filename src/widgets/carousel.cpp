@@ -78,6 +78,11 @@ void Carousel::add_widget(QWidget* widget) {
 
 void Carousel::refresh() { update_props(size()); }
 
+void Carousel::set_aspect_ratio(const QSizeF aspect_ratio) {
+    ratio = aspect_ratio;
+    refresh();
+}
+
 void Carousel::update_props(const QSize size) {
     const auto item_size
         = QSizeF(size.height() * ratio.width() / ratio.height(), size.height());
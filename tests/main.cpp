@@ -23,9 +23,14 @@
  */
 
 #include "test_cards.cpp"
+#include "test_configstore.cpp"
+#include "test_engine.cpp"
 // #include "test_mainwindow.cpp"
+#include "test_slotsampler.cpp"
+#include "test_slotset.cpp"
 #include "test_strategy.cpp"
 #include "test_table.cpp"
+#include "test_tableslot.cpp"
 
 #include <KLocalizedString>
 
@@ -45,9 +50,24 @@ int main(int argc, char* argv[]) {
     TestCards cards_test;
     status |= QTest::qExec(&cards_test, argc, argv);
 
+    TestConfigStore config_store_test;
+    status |= QTest::qExec(&config_store_test, argc, argv);
+
+    TestEngine engine_test;
+    status |= QTest::qExec(&engine_test, argc, argv);
+
+    TestSlotSet slot_set_test;
+    status |= QTest::qExec(&slot_set_test, argc, argv);
+
+    TestSlotSampler slot_sampler_test;
+    status |= QTest::qExec(&slot_sampler_test, argc, argv);
+
     TestTable table_test;
     status |= QTest::qExec(&table_test, argc, argv);
 
+    TestTableSlot table_slot_test;
+    status |= QTest::qExec(&table_slot_test, argc, argv);
+
     // TestMainWindow test_mainwindow;
     // status |= QTest::qExec(&test_mainwindow, argc, argv);
 
@@ -0,0 +1,75 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "configstore.hpp"
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+class TestConfigStore final : public QObject {
+    Q_OBJECT
+private slots:
+    static void flush_round_trip();
+    static void writes_in_background();
+};
+
+void TestConfigStore::flush_round_trip() {
+    const QTemporaryDir dir;
+    const QString path = dir.filePath(QStringLiteral("nested/state.json"));
+    {
+        ConfigStore store(path);
+        QVERIFY(!store.contains(QStringLiteral("settings")));
+        store.set_value(QStringLiteral("settings"), QStringLiteral("a"), 1);
+        store.set_value(QStringLiteral("settings"), QStringLiteral("b"), true);
+        store.set_value(QStringLiteral("settings"), QStringLiteral("a"), 2);
+        store.flush();
+        QVERIFY(QFile::exists(path));
+    }
+    const ConfigStore store(path);
+    QVERIFY(store.contains(QStringLiteral("settings")));
+    QCOMPARE(
+        store.value(QStringLiteral("settings"), QStringLiteral("a")).toInt(), 2
+    );
+    QVERIFY(
+        store.value(QStringLiteral("settings"), QStringLiteral("b")).toBool()
+    );
+    QCOMPARE(store.group(QStringLiteral("settings")).size(), 2);
+}
+
+void TestConfigStore::writes_in_background() {
+    const QTemporaryDir dir;
+    const QString path = dir.filePath(QStringLiteral("state.json"));
+    ConfigStore store(path);
+    store.set_value(QStringLiteral("group"), QStringLiteral("key"), "value");
+    // nothing is written until the changes settle
+    QVERIFY(!QFile::exists(path));
+    QTRY_VERIFY(QFile::exists(path));
+    QTRY_COMPARE(
+        ConfigStore(path)
+            .value(QStringLiteral("group"), QStringLiteral("key"))
+            .toString(),
+        QStringLiteral("value")
+    );
+}
+
+#include "test_configstore.moc"
@@ -0,0 +1,440 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core/deviations.hpp"
+#include "core/engine.hpp"
+#include "core/histogram.hpp"
+#include "core/parallel.hpp"
+#include <QtTest/QtTest>
+
+#include <cstdlib>
+#include <initializer_list>
+#include <numeric>
+
+class TestEngine final : public QObject {
+    Q_OBJECT
+private slots:
+    static void shoe_spaces_jokers();
+    static void ordered_mode_walks_table();
+    static void joker_waits_for_answer();
+    static void finished_slot_waits_for_reshuffle();
+    static void side_counts_update_together();
+    static void strategy_switch_recounts();
+    static void true_count_follows_shoe();
+    static void continuous_shoe_never_runs_out();
+    static void blackjack_round_plays_basic_strategy();
+    static void deviations_follow_index();
+    static void parallel_for_covers_range();
+    static void histogram_quantiles();
+};
+
+namespace {
+class DealLog final : public core::EngineObserver {
+public:
+    void card_dealt(const std::int32_t handle, std::int32_t) override {
+        handles.push_back(handle);
+    }
+
+    void shoe_finished(std::int32_t) override { ++finished; }
+
+    void round_finished(std::int32_t) override { ++rounds; }
+
+    QVector<std::int32_t> handles;
+    int finished = 0;
+    int rounds = 0;
+};
+
+/** Winnings of the round the ranks finish, only the last may end it. */
+std::int32_t
+play(core::BlackjackRound& round, std::initializer_list<std::int32_t> ranks) {
+    std::int32_t left = std::int32_t(ranks.size());
+    for (const std::int32_t rank : ranks) {
+        if (round.add(rank) != (--left == 0)) {
+            return -100;
+        }
+    }
+    return round.get_net();
+}
+
+const core::Strategy hi_lo({ -1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1 });
+} // namespace
+
+void TestEngine::shoe_spaces_jokers() {
+    core::Random rng(3);
+    std::vector<std::int32_t> deck;
+    for (const std::int32_t deck_count : { 1, 2, 6 }) {
+        for (const std::int32_t coefficient : { 2, 3, 4 }) {
+            core::shuffle_shoe(deck, deck_count, coefficient, rng);
+            QCOMPARE(deck.size(), std::size_t(deck_count * core::deck_size));
+            const std::int32_t threshold = core::deck_size / coefficient;
+            std::int32_t last = -1;
+            std::int32_t jokers = 0;
+            QVector<std::int32_t> ranks(core::King + 1);
+            for (std::int32_t i = 0; i < std::int32_t(deck.size()); ++i) {
+                const std::int32_t card = deck[std::size_t(i)];
+                ++ranks[core::rank_of(card)];
+                if (core::is_joker(card)) {
+                    QVERIFY(i - last >= threshold);
+                    last = i;
+                    ++jokers;
+                }
+            }
+            QCOMPARE(jokers, deck_count * core::jokers_per_deck);
+            for (std::int32_t rank = core::Ace; rank <= core::King; ++rank) {
+                QCOMPARE(ranks[rank], 4 * deck_count);
+            }
+        }
+    }
+}
+
+void TestEngine::ordered_mode_walks_table() {
+    core::Engine engine(5);
+    DealLog log;
+    engine.set_observer(&log);
+    QVector<std::int32_t> handles;
+    for (int i = 0; i < 3; ++i) {
+        handles.push_back(engine.add_slot(true));
+        engine.reshuffle(handles.last());
+    }
+    engine.swap_slots(handles[0], handles[2]);
+    for (int i = 0; i < 6; ++i) {
+        QVERIFY(engine.tick());
+    }
+    const QVector<std::int32_t> expected { handles[2], handles[1], handles[0],
+                                           handles[2], handles[1], handles[0] };
+    QCOMPARE(log.handles, expected);
+
+    engine.remove_slot(handles[1]);
+    QCOMPARE(engine.slot_count(), 2);
+    QCOMPARE(engine.add_slot(), handles[1]);
+    QVERIFY(engine.is_fake(handles[1]));
+}
+
+void TestEngine::joker_waits_for_answer() {
+    core::Engine engine(7);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.reshuffle(handle);
+    // with the default spacing the first joker of a single deck comes 27th
+    for (int i = 0; i < 27; ++i) {
+        QVERIFY(engine.tick());
+    }
+    QVERIFY(core::is_joker(engine.get_current_card(handle)));
+    QVERIFY(engine.is_quizzing(handle));
+    QVERIFY(!engine.tick());
+    QVERIFY(engine.has_pending_jokers());
+
+    QVERIFY(engine.answer(handle, engine.get_running_count(handle)));
+    QVERIFY(engine.is_available(handle));
+    QVERIFY(!engine.has_pending_jokers());
+}
+
+void TestEngine::finished_slot_waits_for_reshuffle() {
+    core::Engine engine(11);
+    DealLog log;
+    engine.set_observer(&log);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.reshuffle(handle);
+    while (engine.tick()) {
+        if (engine.is_quizzing(handle)) {
+            engine.answer(handle, 0);
+        }
+    }
+    QCOMPARE(log.handles.size(), qsizetype(core::deck_size));
+    QCOMPARE(log.finished, 1);
+    QVERIFY(engine.is_finished(handle));
+    // a balanced count ends every full deck at zero
+    QCOMPARE(engine.get_running_count(handle), 0);
+
+    engine.reshuffle(handle);
+    QVERIFY(engine.is_available(handle));
+    QVERIFY(engine.tick());
+}
+
+void TestEngine::side_counts_update_together() {
+    const core::Strategy aces({ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 });
+    const core::Strategy fives({ 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0 });
+    const std::vector<core::Strategy> sides { aces, fives };
+    core::Engine engine(5);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.set_side_counts(handle, sides);
+    QCOMPARE(engine.get_counter_count(handle), 3);
+    engine.reshuffle(handle);
+
+    std::array<std::int32_t, 3> expected {};
+    QSet<std::int32_t> quizzed;
+    while (engine.tick()) {
+        const std::int32_t card = engine.get_current_card(handle);
+        if (engine.is_quizzing(handle)) {
+            const std::int32_t counter = engine.get_quizzed_counter(handle);
+            quizzed.insert(counter);
+            const auto asked = static_cast<std::size_t>(counter);
+            QVERIFY(!engine.answer(handle, expected[asked] + 1));
+            continue;
+        }
+        expected[0] = hi_lo.update(expected[0], core::rank_of(card));
+        expected[1] = aces.update(expected[1], core::rank_of(card));
+        expected[2] = fives.update(expected[2], core::rank_of(card));
+        for (std::size_t counter = 0; counter < expected.size(); ++counter) {
+            QCOMPARE(
+                engine.get_running_count(
+                    handle, static_cast<std::int32_t>(counter)
+                ),
+                expected[counter]
+            );
+        }
+    }
+    // four aces counted up, four fives counted down
+    QCOMPARE(engine.get_running_count(handle, 1), 4);
+    QCOMPARE(engine.get_running_count(handle, 2), -4);
+    QVERIFY(!quizzed.isEmpty());
+
+    engine.set_side_counts(handle, {});
+    QCOMPARE(engine.get_counter_count(handle), 1);
+    QCOMPARE(engine.get_running_count(handle, 1), 0);
+}
+
+void TestEngine::strategy_switch_recounts() {
+    const core::Strategy zen({ -1, 1, 1, 2, 2, 2, 1, 0, 0, -2, -2, -2, -2 });
+    core::Engine engine(9);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.set_deck_count(handle, 2);
+    engine.reshuffle(handle);
+    std::int32_t replayed = 0;
+    for (int i = 0; i < 40; ++i) {
+        engine.deal(handle);
+        const std::int32_t card = engine.get_current_card(handle);
+        if (!core::is_joker(card)) {
+            replayed = zen.update(replayed, core::rank_of(card));
+        }
+    }
+    QCOMPARE(engine.count_with(handle, zen), replayed);
+    engine.set_strategy(handle, zen);
+    QCOMPARE(engine.get_running_count(handle), replayed);
+
+    // a side count added mid-shoe starts from the cards already dealt
+    const std::vector<core::Strategy> sides { hi_lo };
+    engine.set_side_counts(handle, sides);
+    QCOMPARE(
+        engine.get_running_count(handle, 1), engine.count_with(handle, hi_lo)
+    );
+    const core::RankCounts& ranks = engine.get_rank_counts(handle);
+    // the jokers among the 40 cards are not ranks
+    QVERIFY(std::accumulate(ranks.cbegin(), ranks.cend(), 0) <= 40);
+
+    engine.restart();
+    QCOMPARE(engine.count_with(handle, zen), 0);
+}
+
+void TestEngine::true_count_follows_shoe() {
+    core::Engine engine(15);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.set_deck_count(handle, 2);
+    engine.reshuffle(handle);
+    const core::Shoe& shoe = engine.get_shoe(handle);
+    QCOMPARE(shoe.standard_remaining(), 104);
+    QCOMPARE(shoe.decks_remaining(), 2.0);
+
+    std::int32_t standard = 0;
+    while (!engine.is_quizzing(handle)) {
+        QVERIFY(engine.tick());
+        standard += core::is_joker(engine.get_current_card(handle)) ? 0 : 1;
+    }
+    const core::RankCounts& left = shoe.get_ranks_left();
+    QCOMPARE(std::accumulate(left.cbegin(), left.cend(), 0), 104 - standard);
+    QCOMPARE(shoe.standard_remaining(), 104 - standard);
+    const double exact = engine.get_running_count(handle) * 52.0
+        / (104 - standard);
+    QCOMPARE(engine.get_true_count(handle), exact);
+    QVERIFY(engine.answer_true_count(
+        handle, core::round_true_count(exact, core::Rounding::Nearest),
+        core::Rounding::Nearest
+    ));
+    QVERIFY(engine.is_available(handle));
+
+    QCOMPARE(core::round_true_count(-1.5, core::Rounding::Floor), -2);
+    QCOMPARE(core::round_true_count(-1.5, core::Rounding::Truncate), -1);
+    QCOMPARE(core::round_true_count(-1.4, core::Rounding::Nearest), -1);
+    QCOMPARE(core::true_count(3, 2, 26), 3.0);
+}
+
+void TestEngine::continuous_shoe_never_runs_out() {
+    core::Random rng(5);
+    core::ContinuousShoe machine;
+    // nothing comes back before the whole deck was dealt once
+    machine.fill(1, core::deck_size - 1);
+    QSet<std::int32_t> first_pass;
+    for (std::int32_t i = 0; i < core::deck_size; ++i) {
+        first_pass.insert(machine.draw(rng));
+        QCOMPARE(machine.size(), core::deck_size);
+    }
+    QCOMPARE(first_pass.size(), qsizetype(core::deck_size));
+    QCOMPARE(machine.in_machine(), 1);
+    for (std::int32_t i = 0; i < 1000; ++i) {
+        machine.draw(rng);
+    }
+    QCOMPARE(machine.in_tray(), core::deck_size - 1);
+    machine.fill(1, 0);
+    machine.draw(rng);
+    QCOMPARE(machine.in_machine(), core::deck_size);
+
+    core::Engine engine(5);
+    engine.set_continuous(true);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.set_deck_count(handle, 1);
+    engine.reshuffle(handle);
+    QVERIFY(engine.get_shoe(handle).empty());
+    for (std::int32_t i = 0; i < 10 * core::deck_size; ++i) {
+        QVERIFY(engine.tick());
+        if (engine.is_quizzing(handle)) {
+            engine.answer(handle, engine.get_running_count(handle));
+        }
+    }
+    QVERIFY(!engine.is_finished(handle));
+    QCOMPARE(engine.get_machine(handle).size(), core::deck_size);
+}
+
+void TestEngine::blackjack_round_plays_basic_strategy() {
+    using namespace core;
+    QCOMPARE(hand_total(add_card(add_card(0, Ace), Six)), 17);
+    QVERIFY(is_soft(add_card(add_card(0, Ace), Six)));
+    QCOMPARE(add_card(add_card(add_card(0, Ten), Six), King), hand_bust);
+
+    // results in half bets, cards in the order they are dealt
+    BlackjackRound round;
+    round.set_seats(1);
+    // 16 stands against a 6, the dealer busts
+    QCOMPARE(play(round, { Ten, Six, Six, Ten, Ten }), 2);
+    // a natural pays 3:2 and leaves the dealer nothing to draw for
+    QCOMPARE(play(round, { Ace, Nine, King, Seven }), 3);
+    // 11 doubles against a 6, the dealer draws to 18
+    QCOMPARE(play(round, { Five, Six, Six, Ten, Ten, Two }), 4);
+    // eights split against a 10, the first hand doubles on 11
+    QCOMPARE(play(round, { Eight, Ten, Eight, Seven, Three, Ten, Ten }), 6);
+    QCOMPARE(round.get_hand_count(), 2);
+    // the dealer peeks and takes the bet at once
+    QCOMPARE(play(round, { Ten, Ace, Nine, King }), -2);
+
+    Engine engine(7);
+    DealLog log;
+    engine.set_observer(&log);
+    engine.set_round_seats(2);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.reshuffle(handle);
+    while (engine.tick()) {
+        if (engine.is_quizzing(handle)) {
+            engine.answer(handle, engine.get_running_count(handle));
+        }
+    }
+    QVERIFY(log.rounds > 0);
+    QCOMPARE(engine.get_round(handle).get_seats(), 2);
+}
+
+void TestEngine::deviations_follow_index() {
+    using namespace core;
+    QVERIFY(deviations[0].is_insurance());
+    // 16 against a ten stands from zero with Hi-Lo
+    const Deviation& sixteen = deviations[1];
+    QCOMPARE(hi_lo_indices[1], std::int8_t { 0 });
+    QVERIFY(play_at(sixteen, hi_lo_indices[1], -1) == Play::Hit);
+    QVERIFY(play_at(sixteen, hi_lo_indices[1], 0) == Play::Stand);
+
+    // a short run finds the insurance index, whatever the thread count
+    IndexParameters parameters;
+    parameters.shoes = 2000;
+    parameters.threads = 4;
+    const auto simulated
+        = compute_indices(builtin_table[1].weights, 1, parameters);
+    QVERIFY(simulated);
+    QVERIFY(std::abs((*simulated)[0] - hi_lo_indices[0]) <= 1);
+    parameters.threads = 1;
+    QVERIFY(compute_indices(builtin_table[1].weights, 1, parameters)
+            == simulated);
+
+    Engine engine(15);
+    const std::int32_t handle = engine.add_slot(true);
+    engine.set_strategy(handle, hi_lo);
+    engine.set_deck_count(handle, 2);
+    engine.reshuffle(handle);
+    while (!engine.is_quizzing(handle)) {
+        QVERIFY(engine.tick());
+    }
+    const std::int32_t true_count = round_true_count(
+        engine.get_true_count(handle), Rounding::Nearest
+    );
+    const Play right = play_at(sixteen, hi_lo_indices[1], true_count);
+    QVERIFY(engine.answer_play(
+        handle, sixteen, hi_lo_indices[1], right, Rounding::Nearest
+    ));
+    QVERIFY(engine.is_available(handle));
+}
+
+void TestEngine::parallel_for_covers_range() {
+    constexpr std::int64_t count = 10007;
+    std::vector<std::atomic<std::int32_t>> visits(count);
+    QVERIFY(core::parallel_for(
+        count, 7, 4,
+        [&](std::int32_t, const std::int64_t begin, const std::int64_t end) {
+            for (std::int64_t i = begin; i < end; ++i) {
+                ++visits[static_cast<std::size_t>(i)];
+            }
+        }
+    ));
+    for (const auto& visit : visits) {
+        QCOMPARE(visit.load(), 1);
+    }
+
+    const std::atomic<bool> cancel { true };
+    QVERIFY(!core::parallel_for(
+        count, 7, 4, [](std::int32_t, std::int64_t, std::int64_t) { }, &cancel
+    ));
+}
+
+void TestEngine::histogram_quantiles() {
+    core::Histogram histogram;
+    histogram.add(3, 2);
+    histogram.add(-2);
+    histogram.add(5);
+    core::Histogram other;
+    other.add(-4);
+    histogram.merge(other);
+
+    QCOMPARE(histogram.count(), std::int64_t { 5 });
+    QCOMPARE(histogram.min(), -4);
+    QCOMPARE(histogram.max(), 5);
+    QCOMPARE(histogram.at(3), std::int64_t { 2 });
+    QCOMPARE(histogram.at(0), std::int64_t { 0 });
+    QCOMPARE(histogram.mean(), 1.0);
+    QCOMPARE(histogram.quantile(0.5), 3);
+    QCOMPARE(histogram.quantile(0.0), -4);
+    QCOMPARE(histogram.quantile(1.0), 5);
+}
+
+#include "test_engine.moc"
@@ -0,0 +1,107 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core/fenwicktree.hpp"
+#include "core/random.hpp"
+#include "core/slotsampler.hpp"
+#include <QtTest/QtTest>
+
+class TestSlotSampler final : public QObject {
+    Q_OBJECT
+private slots:
+    static void fenwick_prefix_search();
+    static void inactive_slots_are_skipped();
+    static void errors_raise_weight();
+    static void staleness_prefers_waiting_slot();
+};
+
+void TestSlotSampler::fenwick_prefix_search() {
+    core::FenwickTree tree;
+    tree.resize(4);
+    tree.set(0, 1.0);
+    tree.set(1, 2.0);
+    tree.set(2, 0.0);
+    tree.set(3, 3.0);
+    QCOMPARE(tree.total(), 6.0);
+    QCOMPARE(tree.find(0.5), 0);
+    QCOMPARE(tree.find(1.0), 1);
+    QCOMPARE(tree.find(2.9), 1);
+    QCOMPARE(tree.find(3.0), 3);
+    QCOMPARE(tree.find(5.9), 3);
+    tree.set(1, 0.0);
+    QCOMPARE(tree.find(1.5), 3);
+}
+
+void TestSlotSampler::inactive_slots_are_skipped() {
+    core::Random rng(7);
+    core::SlotSampler sampler;
+    sampler.set_policy(core::SlotSampler::policy::Mixed);
+    QCOMPARE(sampler.pick(rng), -1);
+    for (std::int32_t handle = 0; handle < 4; ++handle) {
+        sampler.set_active(handle, true);
+    }
+    sampler.set_active(2, false);
+    for (int i = 0; i < 200; ++i) {
+        const std::int32_t handle = sampler.pick(rng);
+        QVERIFY(handle >= 0 && handle < 4 && handle != 2);
+        sampler.dealt(handle);
+    }
+}
+
+void TestSlotSampler::errors_raise_weight() {
+    core::Random rng(11);
+    core::SlotSampler sampler;
+    sampler.set_policy(core::SlotSampler::policy::ErrorRate);
+    sampler.set_active(0, true);
+    sampler.set_active(1, true);
+    for (int i = 0; i < 5; ++i) {
+        sampler.answered(1, false);
+    }
+    int hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        hits += sampler.pick(rng) == 1;
+    }
+    QVERIFY(hits > 1400);
+}
+
+void TestSlotSampler::staleness_prefers_waiting_slot() {
+    core::Random rng(13);
+    core::SlotSampler sampler;
+    sampler.set_policy(core::SlotSampler::policy::Staleness);
+    for (std::int32_t handle = 0; handle < 4; ++handle) {
+        sampler.set_active(handle, true);
+    }
+    for (int round = 0; round < 10; ++round) {
+        for (std::int32_t handle = 0; handle < 3; ++handle) {
+            sampler.dealt(handle);
+        }
+    }
+    int hits = 0;
+    for (int i = 0; i < 1000; ++i) {
+        hits += sampler.pick(rng) == 3;
+    }
+    QVERIFY(hits > 900);
+}
+
+#include "test_slotsampler.moc"
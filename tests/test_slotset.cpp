@@ -0,0 +1,86 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core/random.hpp"
+#include "core/slotset.hpp"
+#include <QtTest/QtTest>
+
+class TestSlotSet final : public QObject {
+    Q_OBJECT
+private slots:
+    static void insert_erase_contains();
+    static void erase_keeps_members_dense();
+    static void pick_other_skips_handle();
+};
+
+void TestSlotSet::insert_erase_contains() {
+    core::SlotSet set;
+    QVERIFY(set.empty());
+    QVERIFY(set.insert(3));
+    QVERIFY(!set.insert(3));
+    QVERIFY(set.insert(0));
+    QCOMPARE(set.size(), 2);
+    QVERIFY(set.contains(3));
+    QVERIFY(!set.contains(1));
+    QVERIFY(!set.contains(42));
+    QVERIFY(set.erase(3));
+    QVERIFY(!set.erase(3));
+    QVERIFY(!set.contains(3));
+    set.clear();
+    QVERIFY(set.empty());
+    QVERIFY(!set.contains(0));
+}
+
+void TestSlotSet::erase_keeps_members_dense() {
+    core::SlotSet set;
+    for (std::int32_t handle = 0; handle < 5; ++handle) {
+        set.insert(handle);
+    }
+    set.erase(1);
+    QCOMPARE(set.size(), 4);
+    QCOMPARE(set.at(1), 4);
+    QSet<qint32> seen;
+    for (const std::int32_t handle : set) {
+        seen.insert(handle);
+    }
+    QVERIFY(seen == QSet<qint32>({ 0, 2, 3, 4 }));
+}
+
+void TestSlotSet::pick_other_skips_handle() {
+    core::Random rng(42);
+    core::SlotSet set;
+    set.insert(7);
+    QCOMPARE(set.pick_other(7, rng), 7);
+    set.insert(2);
+    set.insert(5);
+    QSet<qint32> seen;
+    for (int i = 0; i < 100; ++i) {
+        const std::int32_t handle = set.pick_other(7, rng);
+        QVERIFY(handle != 7);
+        seen.insert(handle);
+    }
+    QVERIFY(seen == QSet<qint32>({ 2, 5 }));
+}
+
+#include "test_slotset.moc"
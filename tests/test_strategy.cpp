@@ -22,14 +22,36 @@
  * SOFTWARE.
  */
 
+#include "core/batch.hpp"
+#include "core/builtins.hpp"
+#include "core/distribution.hpp"
+#include "core/evaluator.hpp"
+#include "core/library.hpp"
+#include "core/optimiser.hpp"
 #include "strategy/strategy.hpp"
+#include "strategy/strategyfiltermodel.hpp"
+#include "strategy/strategylistmodel.hpp"
+#include "strategy/strategyregistry.hpp"
+#include <QStringListModel>
 #include <QtTest/QtTest>
 
+#include <sstream>
+
 class TestStrategy final : public QObject {
     Q_OBJECT
 private slots:
     static void basic_properties();
     static void update_weight();
+    static void builtin_points_at_table();
+    static void registry_lists_builtins_first();
+    static void model_follows_registry();
+    static void filter_finds_substrings();
+    static void library_round_trip();
+    static void fractional_weights();
+    static void evaluation_matches_published_values();
+    static void optimiser_respects_level();
+    static void exact_distribution();
+    static void batch_kernels_agree();
 };
 
 void TestStrategy::basic_properties() {
@@ -49,4 +71,266 @@ void TestStrategy::update_weight() {
     QCOMPARE(s.update_weight(1, 1), 2);
 }
 
+void TestStrategy::builtin_points_at_table() {
+    static const char description[] = "Counts *tens* against the rest.";
+    const core::BuiltinStrategy& ten_count = core::builtin_strategies()[6];
+    const Strategy strategy(ten_count, description);
+    QVERIFY(!strategy.is_custom());
+    QCOMPARE(strategy.get_name(), QStringLiteral("10 Count"));
+    QCOMPARE(strategy.get_description(), QString::fromUtf8(description));
+    QCOMPARE(strategy.get_weights(9), -2);
+    QCOMPARE(strategy.get_counting().level(), ten_count.level);
+    QVERIFY(!strategy.get_counting().is_balanced());
+}
+
+void TestStrategy::registry_lists_builtins_first() {
+    StrategyRegistry& registry = StrategyRegistry::instance();
+    const auto& strategies = registry.get_strategies();
+    QVERIFY(strategies.size() >= qsizetype { core::builtin_count });
+    for (std::size_t i = 0; i < core::builtin_count; ++i) {
+        const auto index = static_cast<qint32>(i);
+        QVERIFY(!registry.get_strategy(index)->is_custom());
+        QCOMPARE(
+            registry.index_of(registry.get_strategy(index)->get_name()), index
+        );
+    }
+    QCOMPARE(registry.get_strategy(-1), nullptr);
+    QCOMPARE(registry.index_of(QStringLiteral("no such count")), -1);
+    // built-in names cannot be taken by custom strategies
+    QCOMPARE(
+        registry.add_custom(QStringLiteral("Hi-Lo Count"), {}, {}), nullptr
+    );
+}
+
+void TestStrategy::model_follows_registry() {
+    StrategyRegistry& registry = StrategyRegistry::instance();
+    const StrategyListModel* model = registry.get_model();
+    QCOMPARE(
+        model->rowCount(), static_cast<int>(registry.get_strategies().size())
+    );
+    QSignalSpy inserted(model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy changed(model, &QAbstractItemModel::dataChanged);
+    QSignalSpy reset(model, &QAbstractItemModel::modelReset);
+
+    const QString name = QStringLiteral("Model Test Count");
+    const QVector<qint32> weights(13, 1);
+    const bool known = registry.index_of(name) >= 0;
+    const Strategy* saved = registry.add_custom(name, {}, weights);
+    QVERIFY(saved);
+    const qint32 row = registry.index_of(name);
+    QCOMPARE(model->data(model->index(row)).toString(), name);
+    QVERIFY(model->data(model->index(row), StrategyListModel::CustomRole)
+                .toBool());
+    // saving again changes the row in place
+    QCOMPARE(registry.add_custom(name, {}, weights), saved);
+    QCOMPARE(inserted.count(), known ? 0 : 1);
+    QCOMPARE(changed.count(), known ? 2 : 1);
+    QCOMPARE(reset.count(), 0);
+    QCOMPARE(
+        model->rowCount(), static_cast<int>(registry.get_strategies().size())
+    );
+}
+
+void TestStrategy::filter_finds_substrings() {
+    QStringListModel names(
+        { QStringLiteral("Hi-Lo Count"), QStringLiteral("Hi-Opt II Count"),
+          QStringLiteral("Zen Count"), QStringLiteral("Level 2 (0.971)") }
+    );
+    StrategyFilterModel filter;
+    filter.setSourceModel(&names);
+    filter.set_query(QStringLiteral("COUNT"));
+    QCOMPARE(filter.rowCount(), 3);
+    filter.set_query(QStringLiteral("i"));
+    QCOMPARE(filter.rowCount(), 2);
+    filter.set_query(QStringLiteral("opt ii"));
+    QCOMPARE(filter.rowCount(), 1);
+    QCOMPARE(filter.index(0, 0).data().toString(), names.stringList()[1]);
+    filter.set_query(QStringLiteral("lox"));
+    QCOMPARE(filter.rowCount(), 0);
+
+    // appended rows are indexed as they arrive
+    filter.set_query(QStringLiteral("zen"));
+    names.insertRows(names.rowCount(), 1);
+    names.setData(names.index(names.rowCount() - 1), QStringLiteral("Zen 2"));
+    QCOMPARE(filter.rowCount(), 2);
+    filter.set_query({});
+    QCOMPARE(filter.rowCount(), names.rowCount());
+}
+
+void TestStrategy::library_round_trip() {
+    const std::vector<core::LibraryEntry> entries {
+        { "Hi-Lo, \"tweaked\"", "Two\nlines", { -1, 1, 1, 1, 1, 1, 0, 0, 0,
+                                                 -1, -1, -1, -1 } },
+        { "Aces", "", { 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5 } },
+    };
+    std::stringstream stream;
+    core::LibraryWriter writer(stream);
+    for (const core::LibraryEntry& entry : entries) {
+        writer.write(entry);
+    }
+    std::string error;
+    const auto read = core::read_library(stream, error);
+    QVERIFY(read);
+    QCOMPARE(read->size(), entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        QCOMPARE((*read)[i].name, entries[i].name);
+        QCOMPARE((*read)[i].description, entries[i].description);
+        QVERIFY((*read)[i].weights == entries[i].weights);
+    }
+
+    // one bad record rejects the whole library
+    std::istringstream invalid(
+        "ok,,0,0,0,0,0,0,0,0,0,0,0,0,0\nbad,,0,0,0,0,0,0,0,0,0,0,0,0,6\n"
+    );
+    QVERIFY(!core::read_library(invalid, error));
+    QVERIFY(error.starts_with("line 2"));
+}
+
+void TestStrategy::fractional_weights() {
+    const core::BuiltinStrategy& builtin = core::builtin_strategies()[7];
+    QCOMPARE(builtin.name, "Wong Halves Count");
+    const core::Strategy halves(builtin.weights, builtin.scale);
+    QCOMPARE(halves.get_scale(), 2);
+    QCOMPARE(halves.deck_sum(), 0);
+    QCOMPARE(core::format_points(halves.update(0, core::Five), 2), "1.5");
+    QCOMPARE(core::format_points(-7, 4), "-1.75");
+
+    std::istringstream input(
+        "name,description,A,2,3,4,5,6,7,8,9,10,J,Q,K\n"
+        "Halves,,-1,0.5,1,1,1.5,1,0.5,0,-0.5,-1,-1,-1,-1\n"
+        "Quarters,,0,0.25,0,0,0,0,0,0,0,0,0,0,-0.25\n"
+    );
+    std::string error;
+    const auto read = core::read_library(input, error);
+    QVERIFY(read);
+    QCOMPARE((*read)[0].scale, 2);
+    QVERIFY((*read)[0].weights == builtin.weights);
+    QCOMPARE((*read)[1].scale, 4);
+    QCOMPARE((*read)[1].weights[1], 1);
+
+    std::ostringstream output;
+    core::LibraryWriter(output).write((*read)[0]);
+    QVERIFY(output.str().ends_with(
+        "Halves,,-1,0.5,1,1,1.5,1,0.5,0,-0.5,-1,-1,-1,-1\n"
+    ));
+
+    // thirds cannot be counted exactly
+    std::istringstream thirds("Thirds,,0.33,0,0,0,0,0,0,0,0,0,0,0,0\n");
+    QVERIFY(!core::read_library(thirds, error));
+}
+
+void TestStrategy::evaluation_matches_published_values() {
+    core::EvaluationParameters parameters;
+    parameters.shoes = 4000;
+    parameters.threads = 1;
+    // Hi-Lo and the unbalanced KO both correlate at about 0.97
+    for (const std::size_t index : { std::size_t { 1 }, std::size_t { 3 } }) {
+        const auto result = core::evaluate(
+            core::builtin_strategies()[index].weights, parameters
+        );
+        QVERIFY(result);
+        QVERIFY(result->betting_correlation > 0.94);
+        QVERIFY(result->betting_correlation < 0.99);
+    }
+    // counting tens is perfect for insurance
+    const auto ten_count
+        = core::evaluate(core::builtin_strategies()[6].weights, parameters);
+    QVERIFY(ten_count->insurance_correlation > 0.99);
+
+    // the same seed deals the same shoes on any number of threads
+    parameters.threads = 3;
+    const auto parallel
+        = core::evaluate(core::builtin_strategies()[6].weights, parameters);
+    QCOMPARE(parallel->betting_correlation, ten_count->betting_correlation);
+    QCOMPARE(parallel->samples, ten_count->samples);
+}
+
+void TestStrategy::optimiser_respects_level() {
+    core::OptimiserParameters parameters;
+    parameters.level = 2;
+    parameters.steps = 30;
+    parameters.keep = 3;
+    parameters.evaluation.shoes = 1000;
+    std::int32_t last_step = 0;
+    const auto best = core::optimise(
+        parameters,
+        [&last_step](const std::int32_t step, const core::Candidate&) {
+            last_step = step;
+        }
+    );
+    QCOMPARE(last_step, parameters.steps);
+    QVERIFY(!best.empty());
+    QVERIFY(best.size() <= parameters.keep);
+    for (std::size_t i = 0; i < best.size(); ++i) {
+        const core::Strategy strategy(best[i].weights);
+        QVERIFY(strategy.is_balanced());
+        for (const std::int32_t weight : best[i].weights) {
+            QVERIFY(std::abs(weight) <= parameters.level);
+        }
+        QVERIFY(i == 0 || best[i - 1].score >= best[i].score);
+    }
+    // the search starts from Hi-Lo, so it can only get better
+    const auto hi_lo = core::evaluate(
+        core::builtin_strategies()[1].weights, parameters.evaluation
+    );
+    QVERIFY(best.front().score >= hi_lo->betting_correlation);
+
+    const std::atomic<bool> cancel { true };
+    QVERIFY(core::optimise(parameters, {}, &cancel).empty());
+}
+
+void TestStrategy::exact_distribution() {
+    // count only aces: two aces in two cards is C(4, 2) / C(52, 2)
+    const core::CountDistribution aces({ 1 }, 1);
+    const core::Distribution two_cards = aces.running_count(2);
+    QCOMPARE(two_cards.offset, 0);
+    QCOMPARE(two_cards.at(2), 6.0 / 1326.0);
+    QCOMPARE(two_cards.at_least(0), 1.0);
+
+    const auto zen = core::CountDistribution::get(
+        core::builtin_strategies()[5].weights, 6
+    );
+    QCOMPARE(zen->total_cards(), 312);
+    // a balanced count always ends at zero
+    const core::Distribution end = zen->running_count(zen->total_cards());
+    QCOMPARE(end.probabilities.size(), std::size_t { 1 });
+    QCOMPARE(end.at(0), 1.0);
+    // hypergeometric variance of the sum of the weights
+    const std::int32_t dealt = zen->at_penetration(0.6);
+    const core::Distribution middle = zen->running_count(dealt);
+    QVERIFY(std::abs(middle.mean()) < 1e-9);
+    const double variance = dealt * 32.0 / 13.0 * (312.0 - dealt) / 311.0;
+    QCOMPARE(middle.variance(), variance);
+    QCOMPARE(zen->true_count(dealt).at_least(-1000), 1.0);
+}
+
+void TestStrategy::batch_kernels_agree() {
+    std::vector<core::Weights> weights;
+    for (const core::BuiltinStrategy& builtin : core::builtin_strategies()) {
+        weights.push_back(builtin.weights);
+    }
+    // an odd length exercises the scalar tail of the vector kernels
+    std::vector<std::int32_t> cards = core::generate_deck(6);
+    cards.push_back(core::make_card(core::Hearts, core::Five));
+
+    const core::CountBatch scalar(weights, core::CountKernel::Scalar);
+    const core::CountBatch best(weights);
+    std::vector<std::int32_t> scalar_counts(weights.size(), 3);
+    std::vector<std::int32_t> best_counts(weights.size(), 3);
+    std::vector<std::int32_t> scalar_traces(weights.size() * cards.size());
+    std::vector<std::int32_t> best_traces(scalar_traces.size());
+    scalar.trace(cards, scalar_counts, scalar_traces);
+    best.trace(cards, best_counts, best_traces);
+    QCOMPARE(best_traces, scalar_traces);
+    QCOMPARE(best_counts, scalar_counts);
+
+    std::fill(best_counts.begin(), best_counts.end(), 0);
+    best.count(cards, best_counts);
+    for (std::size_t s = 0; s < weights.size(); ++s) {
+        const core::Strategy strategy(weights[s]);
+        QCOMPARE(best_counts[s], 6 * strategy.deck_sum() + weights[s][4]);
+        QCOMPARE(scalar_counts[s], best_counts[s] + 3);
+    }
+}
+
 #include "test_strategy.moc"
\ No newline at end of file
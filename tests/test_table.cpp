@@ -22,15 +22,40 @@
  * SOFTWARE.
  */
 
+#include "settings.hpp"
 #include "table/table.hpp"
+#include "table/tableslot.hpp"
 #include <QtTest/QtTest>
 
 class TestTable final : public QObject {
     Q_OBJECT
 private slots:
     static void force_game_over_signal();
+    static void new_game_reuses_slots();
+    static void settings_change_in_one_batch();
 };
 
+namespace {
+/** The slot waiting for a deck count, the last one on the table. */
+TableSlot* fake_slot(const Table& table) {
+    for (TableSlot* slot : table.findChildren<TableSlot*>()) {
+        if (!slot->isHidden() && slot->is_fake()) {
+            return slot;
+        }
+    }
+    return nullptr;
+}
+
+/** Activate slots until @p count of them play. */
+void activate_slots(const Table& table, const qint32 count) {
+    for (qint32 i = 0; i < count; ++i) {
+        TableSlot* slot = fake_slot(table);
+        QVERIFY(slot);
+        slot->activate(1);
+    }
+}
+} // namespace
+
 void TestTable::force_game_over_signal() {
     Table table;
     const QSignalSpy spy(&table, &Table::game_over);
@@ -38,4 +63,52 @@ void TestTable::force_game_over_signal() {
     QCOMPARE(spy.count(), 1);
 }
 
+void TestTable::new_game_reuses_slots() {
+    if (QStandardPaths::locate(
+            QStandardPaths::GenericDataLocation,
+            "carddecks/svg-tigullio-international/tigullio-international.svgz"
+        )
+            .isEmpty()) {
+        QSKIP("the default card theme is not installed");
+    }
+    Table table;
+    table.create_new_game(1);
+    activate_slots(table, 5);
+    const qsizetype built = table.findChildren<TableSlot*>().size();
+    QCOMPARE(built, qsizetype { 6 });
+
+    // the old slots are reset, none is built or destroyed
+    table.create_new_game(3);
+    QCOMPARE(table.findChildren<TableSlot*>().size(), built);
+    TableSlot* first = fake_slot(table);
+    QVERIFY(first);
+    QCOMPARE(first->get_handle(), 0);
+    activate_slots(table, 5);
+    QCOMPARE(table.findChildren<TableSlot*>().size(), built);
+    activate_slots(table, 1);
+    QCOMPARE(table.findChildren<TableSlot*>().size(), built + 1);
+}
+
+void TestTable::settings_change_in_one_batch() {
+    Settings& opts = Settings::instance();
+    const bool indexing = opts.indexing();
+    const bool training = opts.training();
+    QSignalSpy spy(&opts, &Settings::changed);
+    opts.begin_changes();
+    opts.set_indexing(!indexing);
+    opts.set_training(!training);
+    QCOMPARE(spy.count(), 0);
+    opts.end_changes();
+    QCOMPARE(spy.count(), 1);
+    const auto changes = spy.takeFirst().at(0).value<Settings::Changes>();
+    QVERIFY(
+        changes == (Settings::Change::Indexing | Settings::Change::Training)
+    );
+
+    // outside a batch every setter reports on its own
+    opts.set_indexing(indexing);
+    opts.set_training(training);
+    QCOMPARE(spy.count(), 2);
+}
+
 #include "test_table.moc"
\ No newline at end of file
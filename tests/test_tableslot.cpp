@@ -0,0 +1,203 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Yaroslav Riabtsev <yaroslav.riabtsev@rwth-aachen.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core/engine.hpp"
+#include "settings.hpp"
+#include "strategy/strategy.hpp"
+#include "strategy/strategyregistry.hpp"
+#include "table/slottexts.hpp"
+#include "table/tableslot.hpp"
+#include <QSvgRenderer>
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<qint64> allocations { 0 };
+
+/** Forwards the engine events to a single slot widget, like Table does. */
+class SlotForwarder final : public core::EngineObserver {
+public:
+    explicit SlotForwarder(TableSlot* slot)
+        : slot(slot) { }
+
+    void card_dealt(std::int32_t, const std::int32_t card) override {
+        slot->on_card_dealt(card);
+    }
+
+    void joker_dealt(std::int32_t) override { slot->on_joker_dealt(); }
+
+    void shoe_finished(std::int32_t) override { slot->on_shoe_finished(); }
+
+    void round_finished(std::int32_t) override {
+        settled = true;
+        slot->on_round_finished();
+    }
+
+    /** Whether a round was settled since the flag was last cleared. */
+    bool settled = false;
+
+private:
+    TableSlot* slot;
+};
+} // namespace
+
+// Count heap allocations of the whole test binary so that hot paths can
+// assert they do not allocate.
+void* operator new(const std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    std::abort();
+}
+
+void* operator new[](const std::size_t size) { return operator new(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+class TestTableSlot final : public QObject {
+    Q_OBJECT
+private slots:
+    static void dealing_does_not_allocate();
+    static void dealing_to_labels_does_not_allocate();
+    static void dealing_side_counts_does_not_allocate();
+    static void dealing_rounds_does_not_allocate();
+    static void dealing_to_shown_slot_does_not_allocate();
+};
+
+namespace {
+/** What a slot shows while the allocation tests deal to it. */
+struct DealCase {
+    /** Index, penetration and training labels. */
+    bool labels = false;
+    /** Registry strategies kept as side counts, after the main one. */
+    qint32 side_counts = 0;
+    /** Blackjack seats, rounds are played with the dealt cards if any. */
+    qint32 seats = 0;
+    /** Whether the slot is shown, which highlights every card. */
+    bool shown = false;
+};
+
+/**
+ * Deal a warmed up shoe to a slot and check that no card allocates. A
+ * card that settles a blackjack round formats its result once and is left
+ * out.
+ */
+void deal_without_allocating(const DealCase& test) {
+    Settings& opts = Settings::instance();
+    const bool indexing = opts.indexing();
+    const bool penetration = opts.show_penetration();
+    const bool training = opts.training();
+    const bool infinity = opts.infinity_mode();
+    opts.set_indexing(test.labels);
+    opts.set_show_penetration(test.labels);
+    opts.set_training(test.labels);
+    opts.set_infinity_mode(false);
+    {
+        QSvgRenderer renderer;
+        core::Engine engine(42);
+        engine.set_round_seats(test.seats);
+        const qint32 handle = engine.add_slot(true);
+        TableSlot slot(&engine, handle, &renderer);
+        SlotForwarder forwarder(&slot);
+        engine.set_observer(&forwarder);
+        const StrategyRegistry& registry = StrategyRegistry::instance();
+        QVector<const Strategy*> sides;
+        for (qint32 i = 1; i <= test.side_counts; ++i) {
+            sides.push_back(registry.get_strategy(i));
+        }
+        slot.set_side_counts(sides);
+        if (test.shown) {
+            slot.show();
+        }
+
+        // the first shoe warms up the shared name and text caches, the
+        // counts the second one may reach first are formatted up front
+        slot.reshuffle_deck();
+        for (qint32 i = 0; i < 54; ++i) {
+            engine.deal(handle);
+        }
+        const qint32 scale = registry.get_strategy(0)->get_scale();
+        for (qint32 value = -64 * scale; value <= 64 * scale; ++value) {
+            static_cast<void>(SlotTexts::weight(value, scale));
+        }
+        for (const Strategy* side : std::as_const(sides)) {
+            const qint32 side_scale = side->get_scale();
+            for (qint32 value = -64 * side_scale; value <= 64 * side_scale;
+                 ++value) {
+                static_cast<void>(SlotTexts::side_count(
+                    side->get_name(), value, side_scale
+                ));
+            }
+        }
+
+        slot.reshuffle_deck();
+        for (qint32 i = 0; i < 54; ++i) {
+            forwarder.settled = false;
+            const qint64 before = allocations.load();
+            engine.deal(handle);
+            if (!slot.is_joker() && !forwarder.settled) {
+                QCOMPARE(allocations.load() - before, qint64 { 0 });
+            }
+        }
+    }
+    opts.set_indexing(indexing);
+    opts.set_show_penetration(penetration);
+    opts.set_training(training);
+    opts.set_infinity_mode(infinity);
+}
+} // namespace
+
+void TestTableSlot::dealing_does_not_allocate() {
+    deal_without_allocating({});
+}
+
+void TestTableSlot::dealing_to_labels_does_not_allocate() {
+    deal_without_allocating({ .labels = true });
+}
+
+void TestTableSlot::dealing_side_counts_does_not_allocate() {
+    deal_without_allocating({ .labels = true, .side_counts = 2 });
+}
+
+void TestTableSlot::dealing_rounds_does_not_allocate() {
+    deal_without_allocating({ .labels = true, .seats = 3 });
+}
+
+void TestTableSlot::dealing_to_shown_slot_does_not_allocate() {
+    deal_without_allocating(
+        { .labels = true, .side_counts = 2, .seats = 3, .shown = true }
+    );
+}
+
+#include "test_tableslot.moc"